@@ -0,0 +1,354 @@
+/*
+  GED-188 코덱 벤치마크
+  메시지별 인코딩/디코딩 처리량과 메시지당 힙 할당 횟수(allocs_per_msg)를 잰다.
+  JSON 결과는 --benchmark_out=<file> --benchmark_out_format=json 으로 저장한다.
+*/
+
+#include "../cisco/common/decode_resource.hpp"
+#include "../cisco/common/frame_assembler.hpp"
+#include "../cisco/common/request_template.hpp"
+#include "../cisco/control/query_agent_state_conf.hpp"
+#include "../cisco/control/query_agent_state_req.hpp"
+#include "../cisco/message/agent_state_event.hpp"
+#include "../cisco/message/agent_state_event_view.hpp"
+#include "../cisco/miscellaneous/system_event.hpp"
+#include "../cisco/session/heartbeat_conf.hpp"
+#include "../cisco/session/heartbeat_req.hpp"
+#include "../cisco/session/open_conf.hpp"
+#include "../cisco/session/open_req.hpp"
+#include "../cisco/supervisor/agent_team_config_event.hpp"
+#include "./packet_fixture.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <memory_resource>
+#include <new>
+#include <span>
+#include <vector>
+
+namespace {
+std::atomic_uint64_t allocation_count{0};
+} // namespace
+
+void *operator new(const std::size_t size) {
+  allocation_count.fetch_add(1, std::memory_order_relaxed);
+  if (void *pointer = std::malloc(std::max<std::size_t>(size, 1))) {
+    return pointer;
+  }
+
+  throw std::bad_alloc{};
+}
+
+// std::pmr 기본 리소스는 정렬 지정 new 를 쓰므로 함께 센다
+void *operator new(const std::size_t size, const std::align_val_t alignment) {
+  allocation_count.fetch_add(1, std::memory_order_relaxed);
+
+  const std::size_t align = static_cast<std::size_t>(alignment);
+  const std::size_t rounded = (std::max<std::size_t>(size, 1) + align - 1) /
+                              align * align;
+  if (void *pointer = std::aligned_alloc(align, rounded)) {
+    return pointer;
+  }
+
+  throw std::bad_alloc{};
+}
+
+// 위 new 는 malloc/aligned_alloc 으로 할당하므로 free 로 돌려주는 것이 짝이
+// 맞다. GCC 는 delete 가 인라인되면 교체된 operator new 의 결과를 free 에
+// 넘긴다고 보고 -Wmismatched-new-delete 를 내므로 이 구간에서만 끈다
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+void operator delete(void *pointer) noexcept { std::free(pointer); }
+void operator delete(void *pointer, std::size_t) noexcept {
+  std::free(pointer);
+}
+void operator delete(void *pointer, std::align_val_t) noexcept {
+  std::free(pointer);
+}
+void operator delete(void *pointer, std::size_t, std::align_val_t) noexcept {
+  std::free(pointer);
+}
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+namespace {
+/**
+ * @brief 벤치마크 루프 동안의 힙 할당 횟수를 메시지당 값으로 기록
+ *
+ */
+class AllocationCounter {
+public:
+  explicit AllocationCounter(benchmark::State &state)
+      : state{state},
+        begin{allocation_count.load(std::memory_order_relaxed)} {}
+
+  ~AllocationCounter() {
+    const std::uint64_t count =
+        allocation_count.load(std::memory_order_relaxed) - begin;
+    state.counters["allocs_per_msg"] = benchmark::Counter(
+        static_cast<double>(count), benchmark::Counter::kAvgIterations);
+  }
+
+private:
+  benchmark::State &state;
+  std::uint64_t begin;
+};
+
+/**
+ * @brief 수신 메시지 디코딩
+ *
+ * @tparam T
+ * @param state
+ * @param packet
+ */
+template <typename T>
+void decodePacket(benchmark::State &state,
+                  const std::vector<std::byte> &packet) {
+  const AllocationCounter counter{state};
+  for (auto _ : state) {
+    const T message = cisco::common::deserialize<T>(packet);
+    benchmark::DoNotOptimize(message);
+  }
+
+  state.SetItemsProcessed(state.iterations());
+  state.SetBytesProcessed(state.iterations() * packet.size());
+}
+
+/**
+ * @brief 송신 메시지 인코딩
+ *
+ * @tparam T
+ * @param state
+ * @param message
+ */
+template <typename T>
+void encodeMessage(benchmark::State &state, const T &message) {
+  std::size_t packet_size = 0;
+  {
+    const AllocationCounter counter{state};
+    for (auto _ : state) {
+      const std::vector<std::byte> packet = cisco::common::serialize(message);
+      packet_size = packet.size();
+      benchmark::DoNotOptimize(packet.data());
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations());
+  state.SetBytesProcessed(state.iterations() * packet_size);
+}
+
+cisco::session::OpenReq makeOpenReq() {
+  cisco::session::OpenReq open_req{};
+  open_req.setInvokeID(1);
+  open_req.setVersionNumber(24);
+  open_req.setIdleTimeout(300);
+  open_req.setCallMessageMask(0xffff'ffff);
+  open_req.setServicesRequested(0x80 | 0x10 | 0x04);
+  open_req.setAgentStateMask(0x3fff);
+  open_req.setConfigMessageMask(0);
+  open_req.setPeripheralID(5000);
+  open_req.setClientID("ctmonitor");
+  open_req.setClientPW("");
+
+  return open_req;
+}
+
+cisco::control::QueryAgentStateReq makeQueryAgentStateReq() {
+  cisco::control::QueryAgentStateReq query_agent_state_req{};
+  query_agent_state_req.setInvokeID(7);
+  query_agent_state_req.setPeripheralID(5000);
+  query_agent_state_req.setAgentID("1001");
+
+  return query_agent_state_req;
+}
+} // namespace
+
+// 인코딩
+static void BM_EncodeOpenReq(benchmark::State &state) {
+  encodeMessage(state, makeOpenReq());
+}
+BENCHMARK(BM_EncodeOpenReq);
+
+static void BM_EncodeHeartbeatReq(benchmark::State &state) {
+  cisco::session::HeartbeatReq heartbeat_req{};
+  heartbeat_req.setInvokeID(42);
+  encodeMessage(state, heartbeat_req);
+}
+BENCHMARK(BM_EncodeHeartbeatReq);
+
+static void BM_EncodeQueryAgentStateReq(benchmark::State &state) {
+  encodeMessage(state, makeQueryAgentStateReq());
+}
+BENCHMARK(BM_EncodeQueryAgentStateReq);
+
+static void BM_TemplateHeartbeatReq(benchmark::State &state) {
+  cisco::common::RequestTemplate<cisco::session::HeartbeatReq>
+      heartbeat_template{cisco::session::HeartbeatReq{}};
+
+  std::uint32_t invoke_id = 0;
+  {
+    const AllocationCounter counter{state};
+    for (auto _ : state) {
+      heartbeat_template.set<&cisco::session::HeartbeatReq::getInvokeID>(
+          ++invoke_id);
+      benchmark::DoNotOptimize(heartbeat_template.getPacket().data());
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations());
+  state.SetBytesProcessed(state.iterations() *
+                          heartbeat_template.getPacket().size());
+}
+BENCHMARK(BM_TemplateHeartbeatReq);
+
+static void BM_TemplateQueryAgentStateReq(benchmark::State &state) {
+  cisco::common::RequestTemplate<cisco::control::QueryAgentStateReq>
+      query_agent_state_template{cisco::control::QueryAgentStateReq{}};
+
+  std::uint32_t invoke_id = 0;
+  {
+    const AllocationCounter counter{state};
+    for (auto _ : state) {
+      query_agent_state_template
+          .set<&cisco::control::QueryAgentStateReq::getInvokeID>(++invoke_id);
+      query_agent_state_template
+          .set<&cisco::control::QueryAgentStateReq::getPeripheralID>(5000);
+      query_agent_state_template.setFloating(
+          cisco::common::TagValue::AGENT_ID_TAG, "1001");
+      benchmark::DoNotOptimize(query_agent_state_template.getPacket().data());
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations());
+  state.SetBytesProcessed(state.iterations() *
+                          query_agent_state_template.getPacket().size());
+}
+BENCHMARK(BM_TemplateQueryAgentStateReq);
+
+// 디코딩
+static void BM_DecodeOpenConf(benchmark::State &state) {
+  decodePacket<cisco::session::OpenConf>(state, bench::makeOpenConf());
+}
+BENCHMARK(BM_DecodeOpenConf);
+
+static void BM_DecodeHeartbeatConf(benchmark::State &state) {
+  decodePacket<cisco::session::HeartbeatConf>(state,
+                                              bench::makeHeartbeatConf());
+}
+BENCHMARK(BM_DecodeHeartbeatConf);
+
+static void BM_DecodeAgentStateEvent(benchmark::State &state) {
+  decodePacket<cisco::message::AgentStateEvent>(state,
+                                                bench::makeAgentStateEvent());
+}
+BENCHMARK(BM_DecodeAgentStateEvent);
+
+static void BM_ViewAgentStateEvent(benchmark::State &state) {
+  const std::vector<std::byte> packet = bench::makeAgentStateEvent();
+
+  {
+    const AllocationCounter counter{state};
+    for (auto _ : state) {
+      const cisco::message::AgentStateEventView view{packet};
+      benchmark::DoNotOptimize(view.getAgentID());
+      benchmark::DoNotOptimize(view.getAgentState());
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations());
+  state.SetBytesProcessed(state.iterations() * packet.size());
+}
+BENCHMARK(BM_ViewAgentStateEvent);
+
+static void BM_DecodeQueryAgentStateConf(benchmark::State &state) {
+  decodePacket<cisco::control::QueryAgentStateConf>(
+      state, bench::makeQueryAgentStateConf());
+}
+BENCHMARK(BM_DecodeQueryAgentStateConf);
+
+static void BM_DecodeSystemEvent(benchmark::State &state) {
+  decodePacket<cisco::misc::SystemEvent>(state, bench::makeSystemEvent());
+}
+BENCHMARK(BM_DecodeSystemEvent);
+
+static void BM_DecodeAgentTeamConfigEvent(benchmark::State &state) {
+  decodePacket<cisco::supervisor::AgentTeamConfigEvent>(
+      state, bench::makeAgentTeamConfigEvent(
+                 static_cast<std::uint16_t>(state.range(0))));
+  state.counters["agents"] = static_cast<double>(state.range(0));
+}
+BENCHMARK(BM_DecodeAgentTeamConfigEvent)->Arg(10)->Arg(100)->Arg(500);
+
+// 수신 배치 아레나를 디코딩용 리소스로 지정한 경우 (MessageBridge 경로)
+static void BM_DecodeAgentTeamConfigEventArena(benchmark::State &state) {
+  const std::vector<std::byte> packet = bench::makeAgentTeamConfigEvent(
+      static_cast<std::uint16_t>(state.range(0)));
+  std::vector<std::byte> arena_buffer(packet.size() * 2 + 16 * 1'024);
+
+  {
+    const AllocationCounter counter{state};
+    for (auto _ : state) {
+      std::pmr::monotonic_buffer_resource arena{arena_buffer.data(),
+                                                arena_buffer.size()};
+      const cisco::common::ScopedDecodeResource decode_resource{&arena};
+
+      const cisco::supervisor::AgentTeamConfigEvent message =
+          cisco::common::deserialize<cisco::supervisor::AgentTeamConfigEvent>(
+              packet);
+      benchmark::DoNotOptimize(message.getATCAgents().size());
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations());
+  state.SetBytesProcessed(state.iterations() * packet.size());
+  state.counters["agents"] = static_cast<double>(state.range(0));
+}
+BENCHMARK(BM_DecodeAgentTeamConfigEventArena)->Arg(10)->Arg(100)->Arg(500);
+
+// 수신 스트림 분리 (AGENT_STATE_EVENT 묶음을 4KB 씩 수신)
+static void BM_FrameAssemblerBurst(benchmark::State &state) {
+  const std::vector<std::byte> frame = bench::makeAgentStateEvent();
+  std::vector<std::byte> stream{};
+  for (std::int64_t i = 0; i < state.range(0); i++) {
+    stream.insert(stream.end(), frame.begin(), frame.end());
+  }
+
+  cisco::common::FrameAssembler frame_assembler{};
+  std::vector<cisco::common::FrameBoundary> frame_boundaries{};
+  frame_boundaries.reserve(static_cast<std::size_t>(state.range(0)));
+
+  {
+    const AllocationCounter counter{state};
+    for (auto _ : state) {
+      std::size_t position = 0;
+      while (position < stream.size()) {
+        const std::span<std::byte> receive_buffer =
+            frame_assembler.prepare();
+        const std::size_t length = std::min<std::size_t>(
+            {receive_buffer.size(), std::size_t{4'096},
+             stream.size() - position});
+        std::copy_n(stream.begin() + position, length,
+                    receive_buffer.begin());
+        frame_assembler.commit(length);
+        position += length;
+
+        benchmark::DoNotOptimize(
+            frame_assembler.takeFrames(frame_boundaries).data());
+      }
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+  state.SetBytesProcessed(state.iterations() * stream.size());
+}
+BENCHMARK(BM_FrameAssemblerBurst)->Arg(64)->Arg(1'024);
+
+BENCHMARK_MAIN();
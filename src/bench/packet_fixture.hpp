@@ -0,0 +1,176 @@
+#pragma once
+
+#ifndef _CTM_BENCH_PACKET_FIXTURE_HPP_
+#define _CTM_BENCH_PACKET_FIXTURE_HPP_
+
+/*
+  벤치마크용 수신 패킷 픽스처
+  CG 가 보내는 메시지와 같은 모양의 패킷을 만든다. 가변 영역은 실제 CG 가
+  채우는 태그 순서를 따른다.
+*/
+
+#include "../cisco/common/message_type.hpp"
+#include "../cisco/common/packet_builder.hpp"
+#include "../cisco/common/tag_value.hpp"
+#include "../cisco/control/query_agent_state_conf.hpp"
+#include "../cisco/message/agent_state_event.hpp"
+#include "../cisco/miscellaneous/system_event.hpp"
+#include "../cisco/session/heartbeat_conf.hpp"
+#include "../cisco/session/open_conf.hpp"
+#include "../cisco/supervisor/agent_team_config_event.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace bench {
+using cisco::common::PacketBuilder;
+
+/**
+ * @brief OPEN_CONF (Agent State Monitor 세션)
+ *
+ * @return std::vector<std::byte>
+ */
+inline std::vector<std::byte> makeOpenConf() {
+  using cisco::session::OpenConf;
+
+  return PacketBuilder<OpenConf>{cisco::common::MessageType::OPEN_CONF}
+      .fixed<&OpenConf::getInvokeID>(1)
+      .fixed<&OpenConf::getServiceGranted>(0x94)
+      .fixed<&OpenConf::getMonitorID>(1)
+      .fixed<&OpenConf::getPGStatus>(0)
+      .fixed<&OpenConf::getPeripheralOnline>(true)
+      .fixed<&OpenConf::getPeripheralType>(1)
+      .fixed<&OpenConf::getDepartmentID>(-1)
+      .floating(cisco::common::TagValue::NUM_PERIPHERALS_TAG,
+                std::uint16_t{1})
+      .floating(cisco::common::TagValue::MULTI_LINE_AGENT_CONTROL_TAG,
+                std::uint16_t{0})
+      .build();
+}
+
+/**
+ * @brief HEARTBEAT_CONF
+ *
+ * @return std::vector<std::byte>
+ */
+inline std::vector<std::byte> makeHeartbeatConf() {
+  using cisco::session::HeartbeatConf;
+
+  return PacketBuilder<HeartbeatConf>{
+      cisco::common::MessageType::HEARTBEAT_CONF}
+      .fixed<&HeartbeatConf::getInvokeID>(42)
+      .build();
+}
+
+/**
+ * @brief AGENT_STATE_EVENT (스킬 그룹 하나에 로그인한 상담원)
+ *
+ * @return std::vector<std::byte>
+ */
+inline std::vector<std::byte> makeAgentStateEvent() {
+  using cisco::message::AgentStateEvent;
+  using cisco::common::TagValue;
+
+  return PacketBuilder<AgentStateEvent>{
+      cisco::common::MessageType::AGENT_STATE_EVENT}
+      .fixed<&AgentStateEvent::getMonitorID>(1)
+      .fixed<&AgentStateEvent::getPeripheralID>(5000)
+      .fixed<&AgentStateEvent::getPeripheralType>(1)
+      .fixed<&AgentStateEvent::getStateDuration>(12)
+      .fixed<&AgentStateEvent::getSkillGroupNumber>(3001)
+      .fixed<&AgentStateEvent::getSkillGroupID>(5003)
+      .fixed<&AgentStateEvent::getICMAgentID>(5104)
+      .fixed<&AgentStateEvent::getNumFltSkillGroups>(1)
+      .floating(TagValue::CTI_CLIENT_SIGNATURE_TAG, "ctmonitor")
+      .floating(TagValue::AGENT_ID_TAG, "1001")
+      .floating(TagValue::AGENT_EXTENSION_TAG, "71001")
+      .floating(TagValue::AGENT_INSTRUMENT_TAG, "71001")
+      .floating(TagValue::DURATION_TAG, std::uint32_t{12})
+      .floating(TagValue::DIRECTION_TAG, std::uint32_t{0})
+      .floating(TagValue::SKILL_GROUP_NUMBER_TAG, std::int32_t{3001})
+      .floating(TagValue::SKILL_GROUP_ID_TAG, std::uint32_t{5003})
+      .floating(TagValue::SKILL_GROUP_PRIORITY_TAG, std::uint16_t{0})
+      .floating(TagValue::SKILL_GROUP_STATE_TAG, std::uint16_t{3})
+      .build();
+}
+
+/**
+ * @brief QUERY_AGENT_STATE_CONF (스킬 그룹 하나에 로그인한 상담원)
+ *
+ * @return std::vector<std::byte>
+ */
+inline std::vector<std::byte> makeQueryAgentStateConf() {
+  using cisco::control::QueryAgentStateConf;
+  using cisco::common::TagValue;
+
+  return PacketBuilder<QueryAgentStateConf>{
+      cisco::common::MessageType::QUERY_AGENT_STATE_CONF}
+      .fixed<&QueryAgentStateConf::getInvokeID>(7)
+      .fixed<&QueryAgentStateConf::getAgentState>(3)
+      .fixed<&QueryAgentStateConf::getNumSkillGroups>(1)
+      .fixed<&QueryAgentStateConf::getICMAgentID>(5104)
+      .floating(TagValue::AGENT_ID_TAG, "1001")
+      .floating(TagValue::AGENT_EXTENSION_TAG, "71001")
+      .floating(TagValue::AGENT_INSTRUMENT_TAG, "71001")
+      .floating(TagValue::SKILL_GROUP_NUMBER_TAG, std::uint32_t{3001})
+      .floating(TagValue::SKILL_GROUP_ID_TAG, std::uint32_t{5003})
+      .floating(TagValue::SKILL_GROUP_PRIORITY_TAG, std::uint16_t{0})
+      .floating(TagValue::SKILL_GROUP_STATE_TAG, std::uint16_t{3})
+      .floating(TagValue::INTERNAL_AGENT_STATE_TAG, std::uint16_t{3})
+      .build();
+}
+
+/**
+ * @brief AGENT_TEAM_CONFIG_EVENT (number_of_agents 명의 팀)
+ *
+ * @param number_of_agents
+ * @return std::vector<std::byte>
+ */
+inline std::vector<std::byte>
+makeAgentTeamConfigEvent(const std::uint16_t number_of_agents) {
+  using cisco::supervisor::AgentTeamConfigEvent;
+  using cisco::common::TagValue;
+
+  PacketBuilder<AgentTeamConfigEvent> builder{
+      cisco::common::MessageType::AGENT_TEAM_CONFIG_EVENT};
+  builder.fixed<&AgentTeamConfigEvent::getPeripheralID>(5000)
+      .fixed<&AgentTeamConfigEvent::getTeamID>(5010)
+      .fixed<&AgentTeamConfigEvent::getNumberOfAgent>(number_of_agents)
+      .fixed<&AgentTeamConfigEvent::getDepartmentID>(-1)
+      .floating(TagValue::AGENT_TEAM_NAME_TAG, "Seoul Inbound Team");
+
+  for (std::uint16_t i = 0; i < number_of_agents; i++) {
+    builder.floating(TagValue::ATC_AGENT_ID_TAG, std::to_string(10'000 + i))
+        .floating(TagValue::AGENT_FLAGS_TAG,
+                  static_cast<std::uint16_t>(i == 0 ? 1 : 0))
+        .floating(TagValue::ATC_AGENT_STATE_TAG,
+                  static_cast<std::uint16_t>(i % 5))
+        .floating(TagValue::ATC_AGENT_STATE_DURATION_TAG,
+                  static_cast<std::uint16_t>(i * 7));
+  }
+
+  return builder.build();
+}
+
+/**
+ * @brief SYSTEM_EVENT (PG 상태 변경)
+ *
+ * @return std::vector<std::byte>
+ */
+inline std::vector<std::byte> makeSystemEvent() {
+  using cisco::misc::SystemEvent;
+  using cisco::common::TagValue;
+
+  return PacketBuilder<SystemEvent>{cisco::common::MessageType::SYSTEM_EVENT}
+      .fixed<&SystemEvent::getPGStatus>(0)
+      .fixed<&SystemEvent::getSystemEventID>(1)
+      .fixed<&SystemEvent::getEventDeviceType>(0xffff)
+      .floating(TagValue::TEXT_TAG, "Peripheral 5000 is online")
+      .floating(TagValue::EVENT_DEVICE_ID_TAG, "PG1A")
+      .build();
+}
+} // namespace bench
+
+#endif
@@ -24,11 +24,15 @@ public:
   /**
    * @brief Construct a new CTIErrorEvent object
    *
+   * @param session_name 오류가 난 CTI 세션 이름
+   * @param error_host
+   * @param cti_error_type
    */
-  CTIErrorEvent(const std::string_view &error_host,
+  CTIErrorEvent(const std::string_view &session_name,
+                const std::string_view &error_host,
                 const CTIErrorType &cti_error_type)
-      : ErrorEvent(ErrorType::CTI_ERROR), error_host(error_host.data()),
-        cti_error_type(cti_error_type) {};
+      : ErrorEvent(ErrorType::CTI_ERROR), session_name(session_name),
+        error_host(error_host), cti_error_type(cti_error_type) {};
 
   /**
    * @brief Destroy the CTIErrorEvent object
@@ -54,6 +58,13 @@ public:
     return ErrorType::CTI_ERROR;
   }
 
+  /**
+   * @brief Get the Session Name object
+   *
+   * @return const std::string
+   */
+  const std::string getSessionName() const { return session_name; }
+
   /**
    * @brief Get the Error Host object
    *
@@ -70,6 +81,7 @@ public:
 
 protected:
 private:
+  std::string session_name;
   std::string error_host;
   CTIErrorType cti_error_type;
 };
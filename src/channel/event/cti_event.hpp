@@ -4,19 +4,31 @@
 #define _CTM_CHANNEL_EVENT_CTI_EVENT_HPP_
 
 #include "../../cisco/common/message_type.hpp"
+#include "./cti_read_batch.hpp"
 #include "./event.hpp"
 
 #include <cstddef>
-#include <vector>
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <span>
 
 namespace channel::event {
+/**
+ * @brief 한 번의 수신으로 완성된 CTI 메시지 묶음
+ *
+ */
 class CTIEvent : public Event {
 public:
   /**
    * @brief Construct a new CTIEvent object
    *
+   * @param batch 완성된 프레임들과 경계를 담은 수신 배치
+   * @param peripheral_id 배치를 수신한 세션의 Peripheral ID
    */
-  CTIEvent(const std::vector<std::byte> &packet) : packet(packet) {}
+  CTIEvent(const std::shared_ptr<const CTIReadBatch> &batch,
+           const std::uint32_t peripheral_id)
+      : batch(batch), peripheral_id(peripheral_id) {}
 
   /**
    * @brief Destroy the CTIEvent object
@@ -33,26 +45,56 @@ public:
     return EventType::CTI_EVENT;
   }
 
+  /**
+   * @brief 묶음에 들어있는 메시지 수
+   *
+   * @return std::size_t
+   */
+  std::size_t getPacketCount() const { return batch->getFrameCount(); }
+
   /**
    * @brief Get the Packet object
    *
-   * @return const std::vector<std::byte>
+   * @param index
+   * @return std::span<const std::byte>
+   */
+  std::span<const std::byte> getPacket(const std::size_t index) const {
+    return batch->getFrame(index);
+  }
+
+  /**
+   * @brief 배치를 수신한 세션의 Peripheral ID (상담원 ID 는 Peripheral 안에서만
+   * 유일하다)
+   *
+   * @return std::uint32_t
    */
-  const std::vector<std::byte> getPacket() const { return packet; }
+  std::uint32_t getPeripheralID() const { return peripheral_id; }
+
+  /**
+   * @brief 수신 배치 아레나 (이벤트가 처리되어 해제될 때 함께 해제된다)
+   *
+   * @return std::pmr::memory_resource*
+   */
+  std::pmr::memory_resource *getMemoryResource() const {
+    return batch->getMemoryResource();
+  }
 
   /**
    * @brief Get the Message Type object
    *
+   * @param index
    * @return constexpr cisco::common::MessageType
    */
-  constexpr cisco::common::MessageType getMessageType() const {
+  constexpr cisco::common::MessageType
+  getMessageType(const std::size_t index) const {
     return cisco::common::deserialize<cisco::common::MessageType>(
-        std::vector<std::byte>{packet.cbegin() + 4, packet.cbegin() + 8});
+        getPacket(index).subspan(4, 4));
   }
 
 protected:
 private:
-  std::vector<std::byte> packet;
+  std::shared_ptr<const CTIReadBatch> batch;
+  std::uint32_t peripheral_id;
 };
 } // namespace channel::event
 
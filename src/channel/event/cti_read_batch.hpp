@@ -0,0 +1,96 @@
+#pragma once
+
+#ifndef _CTM_CHANNEL_EVENT_CTI_READ_BATCH_HPP_
+#define _CTM_CHANNEL_EVENT_CTI_READ_BATCH_HPP_
+
+/*
+  CTI 수신 배치 아레나
+  +----------------+------------------+----------------------------+
+  | Received Bytes | Frame Boundaries | Decode Scratch (monotonic) |
+  +----------------+------------------+----------------------------+
+  한 번의 수신으로 완성된 프레임들과 그 경계를 아레나에 한 번만 복사한다.
+  디코딩 중 필요한 메모리도 같은 아레나에서 할당하며, 배치를 담은 CTIEvent 가
+  처리되어 해제될 때 아레나 전체가 한 번에 반환된다.
+*/
+
+#include "../../cisco/common/frame_assembler.hpp"
+
+#include <cstddef>
+#include <memory_resource>
+#include <span>
+#include <vector>
+
+namespace channel::event {
+class CTIReadBatch {
+public:
+  /**
+   * @brief Construct a new CTIReadBatch object
+   *
+   * @param bytes 완성된 프레임들 (아레나로 복사된다)
+   * @param boundaries bytes 기준 프레임 경계 (아레나로 복사된다)
+   */
+  CTIReadBatch(const std::span<const std::byte> bytes,
+               const std::span<const cisco::common::FrameBoundary> boundaries)
+      : arena{bytes.size() +
+              boundaries.size() * sizeof(cisco::common::FrameBoundary) +
+              scratch_size},
+        bytes{bytes.begin(), bytes.end(), &arena},
+        boundaries{boundaries.begin(), boundaries.end(), &arena} {}
+
+  CTIReadBatch(const CTIReadBatch &) = delete;
+  CTIReadBatch &operator=(const CTIReadBatch &) = delete;
+
+  /**
+   * @brief Destroy the CTIReadBatch object
+   *
+   */
+  ~CTIReadBatch() = default;
+
+  /**
+   * @brief 수신한 바이트
+   *
+   * @return std::span<const std::byte>
+   */
+  std::span<const std::byte> getBytes() const { return bytes; }
+  /**
+   * @brief 프레임 수
+   *
+   * @return std::size_t
+   */
+  std::size_t getFrameCount() const { return boundaries.size(); }
+  /**
+   * @brief index 번째 프레임 (MHDR 포함)
+   *
+   * @param index
+   * @return std::span<const std::byte>
+   */
+  std::span<const std::byte> getFrame(const std::size_t index) const {
+    const cisco::common::FrameBoundary &boundary = boundaries[index];
+
+    return getBytes().subspan(boundary.offset, boundary.length);
+  }
+
+  /**
+   * @brief 디코딩용 메모리 리소스
+   *
+   * 배치는 한 채널 스레드에서 처리되므로 동기화하지 않는다.
+   *
+   * @return std::pmr::memory_resource*
+   */
+  std::pmr::memory_resource *getMemoryResource() const { return &arena; }
+
+protected:
+private:
+  /**
+   * @brief 수신 바이트 외에 첫 블록에 미리 확보할 디코딩용 공간
+   *
+   */
+  static constexpr std::size_t scratch_size = 16 * 1024;
+
+  mutable std::pmr::monotonic_buffer_resource arena;
+  std::pmr::vector<std::byte> bytes;
+  std::pmr::vector<cisco::common::FrameBoundary> boundaries;
+};
+} // namespace channel::event
+
+#endif
@@ -0,0 +1,115 @@
+#pragma once
+
+#ifndef _CTM_CHANNEL_EVENT_WORKER_HPP_
+#define _CTM_CHANNEL_EVENT_WORKER_HPP_
+
+/*
+  세션 전용 이벤트 처리 스레드
+  +-----------------+  publish()  +--------+  handleEvent()  +------------+
+  | I/O 루프 (pg1)  |  ---------> | worker | --------------> | Subscriber |
+  +-----------------+             +--------+                 +------------+
+  EventChannel 과 달리 싱글톤이 아니고 구독자도 하나다. 대기열은 꺼낼 때만
+  잠그고 처리 중에는 잠그지 않으므로, 처리가 길어져도 발행하는 루프 스레드가
+  기다리지 않는다. 세션마다 하나씩 두어 디코딩이 세션 수만큼 나눠진다.
+*/
+
+#include "./event/event.hpp"
+#include "./subscriber.hpp"
+
+#include <spdlog/spdlog.h>
+
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace channel {
+template <event::DerivedEvent T> class EventWorker {
+public:
+  /**
+   * @brief Construct a new Event Worker object (처리 스레드를 바로 시작한다)
+   *
+   * @param subscriber 이벤트를 처리할 구독자 (워커보다 오래 살아 있어야 한다)
+   */
+  explicit EventWorker(Subscriber *subscriber)
+      : subscriber{subscriber}, worker{[this]() { run(); }} {}
+
+  /**
+   * @brief Destroy the Event Worker object (남은 이벤트를 처리하고 끝낸다)
+   *
+   */
+  ~EventWorker() {
+    {
+      std::lock_guard<std::mutex> lock{mutex};
+      is_stopped = true;
+    }
+    condition.notify_all();
+    worker.join();
+  }
+
+  EventWorker(const EventWorker &) = delete;
+  EventWorker &operator=(const EventWorker &) = delete;
+
+  /**
+   * @brief 이벤트 발행 (모든 스레드, 처리를 기다리지 않는다)
+   *
+   * @param event
+   */
+  void publish(T event) {
+    {
+      std::lock_guard<std::mutex> lock{mutex};
+      events.emplace_back(std::move(event));
+    }
+    condition.notify_one();
+  }
+
+protected:
+private:
+  /**
+   * @brief 처리 스레드 (쌓인 이벤트를 한 번에 꺼내 잠금 없이 처리한다)
+   *
+   */
+  void run() {
+    std::unique_lock<std::mutex> lock{mutex};
+    while (true) {
+      condition.wait(lock, [this]() { return is_stopped || !events.empty(); });
+      if (events.empty()) {
+        return;
+      }
+
+      std::vector<T> pending = std::move(events);
+      events.clear();
+      lock.unlock();
+
+      // 이벤트 하나의 실패가 세션의 처리 스레드를 멈추지 않게 한다
+      for (const T &event : pending) {
+        try {
+          subscriber->handleEvent(&event);
+        } catch (const std::exception &e) {
+          spdlog::error("Unhandled exception in event worker. event_type: {}, "
+                        "reason: {}",
+                        static_cast<std::int32_t>(event.getEventType()),
+                        e.what());
+        }
+      }
+      pending.clear();
+
+      lock.lock();
+    }
+  }
+
+  Subscriber *subscriber;
+
+  std::mutex mutex{};
+  std::condition_variable condition{};
+  std::vector<T> events{};
+  bool is_stopped{false};
+
+  std::thread worker;
+};
+} // namespace channel
+
+#endif
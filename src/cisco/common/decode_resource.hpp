@@ -0,0 +1,62 @@
+#pragma once
+
+#ifndef _CTM_CISCO_COMMON_DECODE_RESOURCE_HPP_
+#define _CTM_CISCO_COMMON_DECODE_RESOURCE_HPP_
+
+/*
+  디코딩용 메모리 리소스
+  역직렬화 함수의 시그니처를 바꾸지 않고, 호출하는 쪽이 스레드 단위로 디코딩
+  결과가 할당될 메모리 리소스를 지정한다. 지정하지 않으면 기본 리소스를 쓴다.
+*/
+
+#include <memory_resource>
+
+namespace cisco::common {
+
+namespace detail {
+inline thread_local std::pmr::memory_resource *decode_resource = nullptr;
+} // namespace detail
+
+/**
+ * @brief 현재 스레드의 디코딩용 메모리 리소스
+ *
+ * @return std::pmr::memory_resource*
+ */
+inline std::pmr::memory_resource *getDecodeResource() {
+  return detail::decode_resource != nullptr ? detail::decode_resource
+                                            : std::pmr::get_default_resource();
+}
+
+/**
+ * @brief 범위 안에서 디코딩용 메모리 리소스를 지정한다
+ *
+ * 범위 안에서 디코딩한 메시지는 범위를 벗어나기 전에 사용을 끝내야 한다.
+ */
+class ScopedDecodeResource {
+public:
+  /**
+   * @brief Construct a new Scoped Decode Resource object
+   *
+   * @param resource
+   */
+  explicit ScopedDecodeResource(std::pmr::memory_resource *resource)
+      : previous{detail::decode_resource} {
+    detail::decode_resource = resource;
+  }
+
+  ScopedDecodeResource(const ScopedDecodeResource &) = delete;
+  ScopedDecodeResource &operator=(const ScopedDecodeResource &) = delete;
+
+  /**
+   * @brief Destroy the Scoped Decode Resource object
+   *
+   */
+  ~ScopedDecodeResource() { detail::decode_resource = previous; }
+
+protected:
+private:
+  std::pmr::memory_resource *previous;
+};
+} // namespace cisco::common
+
+#endif
@@ -0,0 +1,285 @@
+#pragma once
+
+#ifndef _CTM_CISCO_COMMON_FIELD_LAYOUT_HPP_
+#define _CTM_CISCO_COMMON_FIELD_LAYOUT_HPP_
+
+/*
+  고정 영역 레이아웃 기술자
+  +---------+---------+-----+---------+
+  | Field 0 | Field 1 | ... | Field N |
+  +---------+---------+-----+---------+
+  각 필드의 오프셋은 컴파일 타임에 계산되며, 고정 영역 전체 길이를 한 번만
+  검사한 뒤 각 필드를 고정 오프셋에서 바로 읽는다. (MHDR 은 포함하지 않는다)
+  DecodeMask 로 필요한 필드만 골라 읽을 수 있다.
+*/
+
+#include "./serializable.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+namespace cisco::common {
+
+namespace detail {
+/**
+ * @brief Getter 멤버 함수 포인터에서 메시지/필드 타입 추출
+ *
+ * @tparam T
+ */
+template <typename T> struct GetterTraits;
+
+template <typename C, typename R> struct GetterTraits<R (C::*)() const> {
+  using message_type = C;
+  using value_type = std::remove_cvref_t<R>;
+};
+
+/**
+ * @brief 길이 검사 없이 고정 위치의 필드를 읽는다
+ *
+ * 호출 전에 레이아웃 전체 길이가 검사되어 있어야 한다.
+ *
+ * @tparam T
+ * @param data
+ * @return T
+ */
+template <typename T> inline T load(const std::byte *data) {
+  if constexpr (std::is_same_v<T, bool>) {
+    return static_cast<bool>(data[0] | data[1]);
+  } else if constexpr (std::is_enum_v<T>) {
+    return static_cast<T>(load<std::underlying_type_t<T>>(data));
+  } else if constexpr (std::is_integral_v<T>) {
+    std::make_unsigned_t<T> result = 0;
+    for (std::size_t i = 0; i < sizeof(T); i++) {
+      result = static_cast<std::make_unsigned_t<T>>(
+          (result << 8) | static_cast<std::uint8_t>(data[i]));
+    }
+
+    return static_cast<T>(result);
+  } else {
+    return deserialize<T>(std::span<const std::byte>{data, field_size_v<T>});
+  }
+}
+
+/**
+ * @brief 길이 검사 없이 고정 위치에 필드를 기록한다
+ *
+ * 호출 전에 버퍼 길이가 검사되어 있어야 한다.
+ *
+ * @tparam T
+ * @param data
+ * @param value
+ */
+template <typename T> inline void store(std::byte *data, const T value) {
+  if constexpr (std::is_same_v<T, bool>) {
+    store<std::uint16_t>(data, value ? 1 : 0);
+  } else if constexpr (std::is_enum_v<T>) {
+    store(data, static_cast<std::underlying_type_t<T>>(value));
+  } else {
+    static_assert(std::is_integral_v<T>, "Unsupported fixed field type");
+
+    const auto raw = static_cast<std::make_unsigned_t<T>>(value);
+    for (std::size_t i = 0; i < sizeof(T); i++) {
+      data[i] = static_cast<std::byte>(raw >> ((sizeof(T) - 1 - i) * 8));
+    }
+  }
+}
+} // namespace detail
+
+/**
+ * @brief 선택적 역직렬화 마스크
+ *
+ * 각 비트는 레이아웃에 선언된 필드 순서에 대응한다.
+ * 마스크에서 빠진 필드는 읽지 않고 기본값으로 남는다.
+ */
+struct DecodeMask {
+  std::uint64_t fixed{~std::uint64_t{0}};
+  std::uint64_t floating{~std::uint64_t{0}};
+
+  /**
+   * @brief 전체 필드
+   *
+   * @return constexpr DecodeMask
+   */
+  static constexpr DecodeMask all() { return DecodeMask{}; }
+  /**
+   * @brief MHDR 외 필드 없음
+   *
+   * @return constexpr DecodeMask
+   */
+  static constexpr DecodeMask none() { return DecodeMask{0, 0}; }
+};
+
+/**
+ * @brief 마스크에 포함된 필드만 역직렬화 (메시지별로 특수화)
+ *
+ * @tparam T
+ * @param bytes
+ * @param mask
+ * @return const T
+ */
+template <typename T>
+inline const T deserialize(const std::span<const std::byte> bytes,
+                           const DecodeMask mask);
+
+/**
+ * @brief 고정 영역 필드 기술자
+ *
+ * @tparam Getter 직렬화 시 값을 가져올 멤버 함수
+ * @tparam Setter 역직렬화 시 값을 저장할 멤버 함수
+ */
+template <auto Getter, auto Setter> struct Field {
+  using message_type =
+      typename detail::GetterTraits<decltype(Getter)>::message_type;
+  using value_type =
+      typename detail::GetterTraits<decltype(Getter)>::value_type;
+
+  static constexpr auto getter = Getter;
+  static constexpr std::size_t size = field_size_v<value_type>;
+
+  /**
+   * @brief 필드 역직렬화
+   *
+   * @param data
+   * @param message
+   */
+  static void decode(const std::byte *data, message_type &message) {
+    (message.*Setter)(detail::load<value_type>(data));
+  }
+
+  /**
+   * @brief 필드 직렬화
+   *
+   * @param writer
+   * @param message
+   */
+  static void encode(ByteWriter &writer, const message_type &message) {
+    writer.write((message.*Getter)());
+  }
+};
+
+/**
+ * @brief 고정 영역 레이아웃
+ *
+ * @tparam Fields
+ */
+template <typename... Fields> struct FieldLayout {
+  static_assert(sizeof...(Fields) <= 64, "Too many fields for DecodeMask");
+
+  /**
+   * @brief 고정 영역 전체 길이
+   *
+   */
+  static constexpr std::size_t size = (Fields::size + ... + 0);
+
+  /**
+   * @brief 각 필드의 오프셋
+   *
+   */
+  static constexpr std::array<std::size_t, sizeof...(Fields)> offsets = [] {
+    std::array<std::size_t, sizeof...(Fields)> result{};
+    std::size_t offset = 0;
+    std::size_t index = 0;
+    ((result[index++] = offset, offset += Fields::size), ...);
+
+    return result;
+  }();
+
+  /**
+   * @brief Getter 에 해당하는 필드의 오프셋 (컴파일 타임)
+   *
+   * @tparam Getter
+   * @return constexpr std::size_t
+   */
+  template <auto Getter> static constexpr std::size_t offsetOf() {
+    constexpr std::size_t index = indexOf<Getter>();
+    static_assert(index < sizeof...(Fields), "Field is not in this layout");
+
+    return offsets[index];
+  }
+
+  /**
+   * @brief Getter 들에 해당하는 필드의 마스크 (컴파일 타임)
+   *
+   * @tparam Getters
+   * @return constexpr std::uint64_t
+   */
+  template <auto... Getters> static constexpr std::uint64_t maskOf() {
+    static_assert(((indexOf<Getters>() < sizeof...(Fields)) && ...),
+                  "Field is not in this layout");
+
+    return ((std::uint64_t{1} << indexOf<Getters>()) | ... | 0);
+  }
+
+  /**
+   * @brief 고정 영역을 읽어 메시지에 저장하고 커서를 이동
+   *
+   * @tparam Message
+   * @param reader
+   * @param message
+   * @param mask 읽을 필드 (DecodeMask::fixed)
+   */
+  template <typename Message>
+  static void decode(ByteReader &reader, Message &message,
+                     const std::uint64_t mask = ~std::uint64_t{0}) {
+    const std::byte *data = reader.readBytes(size).data();
+
+    decode(data, message, mask, std::index_sequence_for<Fields...>{});
+  }
+
+  /**
+   * @brief 메시지의 고정 영역을 기록
+   *
+   * @tparam Message
+   * @param writer
+   * @param message
+   */
+  template <typename Message>
+  static void encode(ByteWriter &writer, const Message &message) {
+    (Fields::encode(writer, message), ...);
+  }
+
+private:
+  template <typename Message, std::size_t... I>
+  static void decode(const std::byte *data, Message &message,
+                     const std::uint64_t mask, std::index_sequence<I...>) {
+    ((((mask >> I) & 1) != 0 ? Fields::decode(data + offsets[I], message)
+                             : void()),
+     ...);
+  }
+
+  template <auto Getter> static constexpr std::size_t indexOf() {
+    constexpr std::array<bool, sizeof...(Fields)> matches = {
+        isSameGetter<Fields::getter, Getter>()...};
+
+    for (std::size_t i = 0; i < matches.size(); i++) {
+      if (matches[i]) {
+        return i;
+      }
+    }
+
+    return sizeof...(Fields);
+  }
+
+  template <auto Lhs, auto Rhs> static constexpr bool isSameGetter() {
+    if constexpr (std::is_same_v<decltype(Lhs), decltype(Rhs)>) {
+      return Lhs == Rhs;
+    } else {
+      return false;
+    }
+  }
+};
+
+/**
+ * @brief 메시지별 고정 영역 레이아웃 (각 메시지 헤더에서 특수화)
+ *
+ * @tparam T
+ */
+template <typename T> struct MessageLayout;
+
+} // namespace cisco::common
+
+#endif
@@ -0,0 +1,182 @@
+#pragma once
+
+#ifndef _CTM_CISCO_COMMON_FIXED_STRING_HPP_
+#define _CTM_CISCO_COMMON_FIXED_STRING_HPP_
+
+/*
+  고정 용량 인라인 문자열
+  +--------+-----------------+
+  | Length | Buffer[N]       |
+  +--------+-----------------+
+  GED-188 식별자 필드는 최대 길이가 정해져 있으므로 힙 할당 없이 객체 내부에
+  저장한다. 널 문자 이후와 용량을 넘는 부분은 버린다.
+*/
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+
+namespace cisco::common {
+/**
+ * @brief 고정 용량 인라인 문자열
+ *
+ * @tparam N 최대 문자 수
+ */
+template <std::size_t N> class FixedString {
+  static_assert(N > 0 && N <= UINT8_MAX, "FixedString capacity is 1..255");
+
+public:
+  /**
+   * @brief Construct a new Fixed String object
+   *
+   */
+  constexpr FixedString() = default;
+  /**
+   * @brief Construct a new Fixed String object
+   *
+   * @param value
+   */
+  constexpr FixedString(const std::string_view value) { assign(value); }
+  /**
+   * @brief Construct a new Fixed String object
+   *
+   * @param value
+   */
+  constexpr FixedString(const char *value)
+      : FixedString(std::string_view{value}) {}
+
+  /**
+   * @brief 비교 연산 오버로딩
+   *
+   * @param rhs
+   * @return true
+   * @return false
+   */
+  constexpr bool operator==(const FixedString &rhs) const {
+    return view() == rhs.view();
+  }
+  /**
+   * @brief 비교 연산 오버로딩
+   *
+   * @param rhs
+   * @return true
+   * @return false
+   */
+  constexpr bool operator==(const std::string_view rhs) const {
+    return view() == rhs;
+  }
+
+  /**
+   * @brief string_view 로 변환
+   *
+   * @return std::string_view
+   */
+  constexpr operator std::string_view() const { return view(); }
+
+  /**
+   * @brief 값을 교체한다 (널 문자 이후와 용량 초과분은 버린다)
+   *
+   * @param value
+   */
+  constexpr void assign(const std::string_view value) {
+    const std::string_view trimmed = value.substr(0, value.find('\0'));
+
+    length = static_cast<std::uint8_t>(std::min(trimmed.size(), N));
+    std::copy_n(trimmed.begin(), length, buffer.begin());
+  }
+
+  /**
+   * @brief Get the View object
+   *
+   * @return constexpr std::string_view
+   */
+  constexpr std::string_view view() const {
+    return std::string_view{buffer.data(), length};
+  }
+  /**
+   * @brief std::string 복사본
+   *
+   * @return std::string
+   */
+  std::string str() const { return std::string{view()}; }
+  /**
+   * @brief Get the Data object
+   *
+   * @return constexpr const char*
+   */
+  constexpr const char *data() const { return buffer.data(); }
+  /**
+   * @brief Get the Size object
+   *
+   * @return constexpr std::size_t
+   */
+  constexpr std::size_t size() const { return length; }
+  /**
+   * @brief 빈 문자열인지 판단
+   *
+   * @return true
+   * @return false
+   */
+  constexpr bool empty() const { return length == 0; }
+  /**
+   * @brief 최대 문자 수
+   *
+   * @return constexpr std::size_t
+   */
+  static constexpr std::size_t capacity() { return N; }
+
+  /**
+   * @brief FNV-1a 해시
+   *
+   * @return constexpr std::size_t
+   */
+  constexpr std::size_t hash() const {
+    std::uint64_t result = 14695981039346656037ULL;
+    for (std::size_t i = 0; i < length; i++) {
+      result ^= static_cast<std::uint8_t>(buffer[i]);
+      result *= 1099511628211ULL;
+    }
+
+    return static_cast<std::size_t>(result);
+  }
+
+protected:
+private:
+  std::uint8_t length{0};
+  std::array<char, N> buffer{};
+};
+
+/**
+ * @brief 상담원 ID (GED-188 AgentID 최대 12 바이트)
+ *
+ */
+using AgentIDString = FixedString<12>;
+/**
+ * @brief 내선 번호 (GED-188 AgentExtension 최대 16 바이트)
+ *
+ */
+using AgentExtensionString = FixedString<16>;
+/**
+ * @brief 상담원 장치 (GED-188 AgentInstrument 최대 64 바이트)
+ *
+ */
+using AgentInstrumentString = FixedString<64>;
+/**
+ * @brief CTI 클라이언트 서명 (GED-188 CTIClientSignature 최대 64 바이트)
+ *
+ */
+using ClientSignatureString = FixedString<64>;
+} // namespace cisco::common
+
+template <std::size_t N> struct std::hash<cisco::common::FixedString<N>> {
+  constexpr std::size_t
+  operator()(const cisco::common::FixedString<N> &value) const {
+    return value.hash();
+  }
+};
+
+#endif
@@ -18,6 +18,7 @@
 #include <cstdint>
 #include <cstring>
 #include <iterator>
+#include <span>
 #include <vector>
 
 namespace cisco::common {
@@ -50,9 +51,9 @@ public:
   /**
    * @brief Get the Data object
    *
-   * @return const std::vector<std::byte>
+   * @return const std::vector<std::byte>&
    */
-  const std::vector<std::byte> getData() const { return data; }
+  const std::vector<std::byte> &getData() const { return data; }
 
   /**
    * @brief Set the Tag object
@@ -85,34 +86,46 @@ private:
   std::vector<std::byte> data;
 };
 
+/**
+ * @brief 가변 필드 기록 (Tag, Length, Data)
+ *
+ * @param floating_data
+ */
+template <>
+inline void ByteWriter::write<FloatingData>(const FloatingData &floating_data) {
+  write(floating_data.getTag());
+  write(static_cast<std::uint16_t>(floating_data.getData().size()));
+  writeBytes(floating_data.getData());
+}
+
 template <>
 inline const std::vector<std::byte>
 serialize(const FloatingData &floating_data) {
-  std::vector<std::byte> result{};
+  ByteWriter writer{4 + floating_data.getData().size()};
+  writer.write(floating_data);
 
-  const auto tag = serialize(floating_data.getTag());
-  const auto length =
-      serialize(static_cast<uint16_t>(floating_data.getData().size()));
-  const auto data = serialize(floating_data.getData());
+  return writer.release();
+}
 
-  std::move(tag.cbegin(), tag.cend(), std::back_inserter(result));
-  std::move(length.cbegin(), length.cend(), std::back_inserter(result));
-  std::move(data.cbegin(), data.cend(), std::back_inserter(result));
+/**
+ * @brief 가변 필드를 읽고 커서를 이동 (Tag, Length, Data)
+ *
+ * @return const FloatingData
+ */
+template <> inline const FloatingData ByteReader::read<FloatingData>() {
+  FloatingData floating_data{};
+  floating_data.setTag(read<TagValue>());
+  const std::uint16_t length = read<std::uint16_t>();
+  floating_data.setData(deserialize<std::vector<std::byte>>(readBytes(length)));
 
-  return result;
+  return floating_data;
 }
 
 template <>
-inline const FloatingData deserialize(const std::vector<std::byte> &bytes) {
-  FloatingData floating_data{};
-  floating_data.setTag(deserialize<TagValue>(
-      std::vector<std::byte>(bytes.cbegin(), bytes.cbegin() + 2)));
-  uint16_t length = deserialize<std::uint16_t>(
-      std::vector<std::byte>(bytes.cbegin() + 2, bytes.cbegin() + 4));
-  floating_data.setData(deserialize<std::vector<std::byte>>(
-      std::vector<std::byte>(bytes.cbegin() + 4, bytes.cbegin() + 4 + length)));
+inline const FloatingData deserialize(const std::span<const std::byte> bytes) {
+  ByteReader reader{bytes};
 
-  return floating_data;
+  return reader.read<FloatingData>();
 }
 
 } // namespace cisco::common
@@ -0,0 +1,191 @@
+#pragma once
+
+#ifndef _CTM_CISCO_COMMON_FLOATING_LAYOUT_HPP_
+#define _CTM_CISCO_COMMON_FLOATING_LAYOUT_HPP_
+
+/*
+  가변 영역 디스패치 테이블
+  +-----+--------+------+-----+-----+--------+------+
+  | Tag | Length | Data | ... | Tag | Length | Data |
+  +-----+--------+------+-----+-----+--------+------+
+  태그 번호를 인덱스로 하는 핸들러 테이블을 컴파일 타임에 생성하고, 가변 영역을
+  한 번만 훑으며 등록된 태그만 원본 버퍼에서 바로 읽는다.
+  등록되지 않았거나 마스크에서 빠진 태그는 길이만큼 건너뛴다.
+*/
+
+#include "./serializable.hpp"
+#include "./tag_value.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+#include <type_traits>
+
+namespace cisco::common {
+
+namespace detail {
+/**
+ * @brief Setter 멤버 함수 포인터에서 메시지/필드 타입 추출
+ *
+ * @tparam T
+ */
+template <typename T> struct SetterTraits;
+
+template <typename C, typename A> struct SetterTraits<void (C::*)(A)> {
+  using message_type = C;
+  using value_type = std::remove_cvref_t<A>;
+};
+
+/**
+ * @brief 가변 필드 데이터를 Setter 인자 타입으로 변환
+ *
+ * 문자열은 복사하지 않고 원본 버퍼를 가리키는 string_view 로 넘긴다.
+ *
+ * @tparam T
+ * @param data
+ * @return T
+ */
+template <typename T>
+inline T loadFloating(const std::span<const std::byte> data) {
+  if constexpr (std::is_same_v<T, std::string_view>) {
+    return std::string_view{reinterpret_cast<const char *>(data.data()),
+                            data.size()};
+  } else {
+    return deserialize<T>(data);
+  }
+}
+} // namespace detail
+
+/**
+ * @brief 가변 영역 필드 기술자
+ *
+ * Handler 는 메시지의 Setter 멤버 함수이거나,
+ * void (*)(std::span<const std::byte>, Message &) 형태의 함수이다.
+ *
+ * @tparam Tag
+ * @tparam Handler
+ */
+template <TagValue Tag, auto Handler> struct FloatingField {
+  static constexpr TagValue tag = Tag;
+
+  /**
+   * @brief 필드 역직렬화
+   *
+   * @tparam Message
+   * @param data
+   * @param message
+   */
+  template <typename Message>
+  static void decode(const std::span<const std::byte> data, Message &message) {
+    if constexpr (std::is_member_function_pointer_v<decltype(Handler)>) {
+      using value_type =
+          typename detail::SetterTraits<decltype(Handler)>::value_type;
+
+      (message.*Handler)(detail::loadFloating<value_type>(data));
+    } else {
+      Handler(data, message);
+    }
+  }
+};
+
+/**
+ * @brief 가변 영역 레이아웃
+ *
+ * @tparam Message 핸들러에 전달할 디코딩 대상
+ * @tparam Fields
+ */
+template <typename Message, typename... Fields> struct FloatingLayout {
+  static_assert(sizeof...(Fields) <= 64, "Too many fields for DecodeMask");
+
+  using Handler = void (*)(const std::span<const std::byte>, Message &);
+
+  /**
+   * @brief 핸들러 테이블 항목
+   *
+   */
+  struct Entry {
+    Handler handler = nullptr;
+    std::uint64_t bit = 0;
+  };
+
+  /**
+   * @brief 태그 번호로 인덱싱하는 핸들러 테이블 (등록되지 않은 태그는 비어있다)
+   *
+   */
+  static constexpr auto handlers = [] {
+    constexpr std::size_t table_size =
+        std::max({std::size_t{0},
+                  static_cast<std::size_t>(Fields::tag) + 1 ...});
+
+    std::array<Entry, table_size> result{};
+    std::uint64_t bit = 1;
+    ((result[static_cast<std::size_t>(Fields::tag)] =
+          Entry{&Fields::template decode<Message>, bit},
+      bit <<= 1),
+     ...);
+
+    return result;
+  }();
+
+  static_assert(
+      [] {
+        std::size_t registered = 0;
+        for (const Entry &entry : handlers) {
+          registered += entry.handler != nullptr ? 1 : 0;
+        }
+
+        return registered == sizeof...(Fields);
+      }(),
+      "Duplicated tag in floating layout");
+
+  /**
+   * @brief 태그들에 해당하는 필드의 마스크 (컴파일 타임)
+   *
+   * @tparam Tags
+   * @return constexpr std::uint64_t
+   */
+  template <TagValue... Tags> static constexpr std::uint64_t maskOf() {
+    static_assert(((static_cast<std::size_t>(Tags) < handlers.size() &&
+                    handlers[static_cast<std::size_t>(Tags)].bit != 0) &&
+                   ...),
+                  "Tag is not in this layout");
+
+    return (handlers[static_cast<std::size_t>(Tags)].bit | ... | 0);
+  }
+
+  /**
+   * @brief end 위치까지 가변 영역을 읽어 핸들러 호출
+   *
+   * @param reader
+   * @param end 가변 영역이 끝나는 위치 (MHDR 포함 메시지 길이)
+   * @param message
+   * @param mask 읽을 필드 (DecodeMask::floating)
+   */
+  static void decode(ByteReader &reader, const std::size_t end,
+                     Message &message,
+                     const std::uint64_t mask = ~std::uint64_t{0}) {
+    while (reader.getPosition() < end) {
+      const std::uint16_t tag = reader.read<std::uint16_t>();
+      const std::uint16_t length = reader.read<std::uint16_t>();
+      const std::span<const std::byte> data = reader.readBytes(length);
+
+      if (tag < handlers.size() && (handlers[tag].bit & mask) != 0) {
+        handlers[tag].handler(data, message);
+      }
+    }
+  }
+};
+
+/**
+ * @brief 메시지별 가변 영역 레이아웃 (각 메시지 헤더에서 특수화)
+ *
+ * @tparam T
+ */
+template <typename T> struct MessageFloatingLayout;
+
+} // namespace cisco::common
+
+#endif
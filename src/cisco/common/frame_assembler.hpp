@@ -0,0 +1,215 @@
+#pragma once
+
+#ifndef _CTM_CISCO_COMMON_FRAME_ASSEMBLER_HPP_
+#define _CTM_CISCO_COMMON_FRAME_ASSEMBLER_HPP_
+
+/*
+  MHDR 프레임 조립기
+  +----------+-----------------+---------------+------------+
+  | Consumed | Complete Frames | Partial Frame | Free Space |
+  +----------+-----------------+---------------+------------+
+             ^ read                            ^ write
+  수신한 바이트를 버퍼 뒤에 이어 붙이고, MHDR 길이만큼 모인 프레임만 원본 버퍼를
+  가리키는 구간으로 꺼낸다. 여러 번의 수신에 걸친 프레임은 다음 수신까지 남겨
+  둔다.
+  프레임 구간이 끊기지 않도록 둘러싸기(wrap) 대신, 쓸 공간이 모자랄 때 남은
+  미완성 프레임만 앞으로 당기고, 그래도 모자라면 버퍼를 키운다.
+  한 번의 수신이 요청한 크기를 가득 채우면 다음 수신 크기를 늘리고, 한참 덜
+  채우면 줄인다.
+*/
+
+#include "./field_layout.hpp"
+#include "./mhdr.hpp"
+#include "./serializable.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+namespace cisco::common {
+/**
+ * @brief 프레임 구간 안에서 한 프레임의 위치
+ *
+ */
+struct FrameBoundary {
+  std::size_t offset;
+  std::size_t length;
+};
+
+class FrameAssembler {
+public:
+  /**
+   * @brief Construct a new Frame Assembler object
+   *
+   * @param min_read_size 한 번에 수신할 최소 크기
+   * @param max_read_size 한 번에 수신할 최대 크기
+   * @param max_frame_length 허용하는 최대 프레임 길이 (MHDR 포함)
+   */
+  explicit FrameAssembler(const std::size_t min_read_size = 4'096,
+                          const std::size_t max_read_size = 64 * 1'024,
+                          const std::size_t max_frame_length = 1'024 * 1'024)
+      : min_read_size{min_read_size}, max_read_size{max_read_size},
+        max_frame_length{max_frame_length}, read_size{min_read_size},
+        buffer(min_read_size) {}
+
+  /**
+   * @brief Destroy the Frame Assembler object
+   *
+   */
+  ~FrameAssembler() = default;
+
+  /**
+   * @brief 다음 수신에 쓸 공간을 확보한다
+   *
+   * 이전에 꺼낸 프레임 구간은 더 이상 유효하지 않다.
+   *
+   * @return std::span<std::byte> 수신할 위치 (getReadSize() 바이트)
+   */
+  std::span<std::byte> prepare() {
+    if (read_index == write_index) {
+      read_index = 0;
+      write_index = 0;
+    }
+
+    if (buffer.size() - write_index < read_size) {
+      // 이미 꺼낸 프레임 자리를 비우고, 미완성 프레임만 앞으로 당긴다
+      const std::size_t pending = write_index - read_index;
+      if (read_index > 0) {
+        std::memmove(buffer.data(), buffer.data() + read_index, pending);
+        read_index = 0;
+        write_index = pending;
+      }
+
+      if (buffer.size() - write_index < read_size) {
+        buffer.resize(std::max(buffer.size() * 2, write_index + read_size));
+      }
+    }
+
+    return std::span<std::byte>{buffer}.subspan(write_index, read_size);
+  }
+
+  /**
+   * @brief prepare() 로 받은 공간에 수신한 길이를 반영한다
+   *
+   * @param length
+   */
+  void commit(const std::size_t length) {
+    write_index += std::min(length, read_size);
+
+    // 요청한 만큼 가득 찼다면 소켓에 더 남아 있을 가능성이 높다
+    if (length >= read_size) {
+      read_size = std::min(read_size * 2, max_read_size);
+    } else if (length < read_size / 4) {
+      read_size = std::max(read_size / 2, min_read_size);
+    }
+  }
+
+  /**
+   * @brief 다음 완성된 프레임 (MHDR 포함)
+   *
+   * 연속으로 꺼낸 프레임들은 버퍼에서 이어져 있다.
+   *
+   * @return std::optional<std::span<const std::byte>> 미완성이면 std::nullopt
+   */
+  std::optional<std::span<const std::byte>> next() {
+    const std::size_t length = frameLength(read_index);
+    if (length == 0) {
+      return std::nullopt;
+    }
+
+    const std::span<const std::byte> frame =
+        std::span<const std::byte>{buffer}.subspan(read_index, length);
+    read_index += length;
+
+    return frame;
+  }
+
+  /**
+   * @brief 지금까지 완성된 프레임들을 한 구간으로 꺼낸다
+   *
+   * MHDR 헤더만 따라가며 한 번 훑고, 각 프레임의 경계를 boundaries 에 담는다.
+   *
+   * @param boundaries 반환 구간 기준 프레임 경계 (기존 내용은 지운다)
+   * @return std::span<const std::byte> 완성된 프레임이 없으면 빈 구간
+   */
+  std::span<const std::byte>
+  takeFrames(std::vector<FrameBoundary> &boundaries) {
+    boundaries.clear();
+
+    const std::size_t begin = read_index;
+    for (std::size_t length = frameLength(read_index); length != 0;
+         length = frameLength(read_index)) {
+      boundaries.emplace_back(FrameBoundary{read_index - begin, length});
+      read_index += length;
+    }
+
+    return std::span<const std::byte>{buffer}.subspan(begin,
+                                                      read_index - begin);
+  }
+
+  /**
+   * @brief 다음 수신 크기
+   *
+   * @return constexpr std::size_t
+   */
+  constexpr std::size_t getReadSize() const { return read_size; }
+  /**
+   * @brief 아직 완성되지 않은 프레임 바이트 수
+   *
+   * @return constexpr std::size_t
+   */
+  constexpr std::size_t getPendingSize() const {
+    return write_index - read_index;
+  }
+
+  /**
+   * @brief 연결이 바뀌었을 때 남은 바이트를 버린다
+   *
+   */
+  void reset() {
+    read_index = 0;
+    write_index = 0;
+    read_size = min_read_size;
+  }
+
+protected:
+private:
+  /**
+   * @brief index 에서 시작하는 프레임이 완성되었으면 그 길이
+   *
+   * @param index
+   * @return std::size_t 미완성이면 0
+   */
+  std::size_t frameLength(const std::size_t index) const {
+    const std::size_t available = write_index - index;
+    if (available < field_size_v<MHDR>) {
+      return 0;
+    }
+
+    const std::size_t length =
+        detail::load<std::uint32_t>(buffer.data() + index) +
+        field_size_v<MHDR>;
+    if (length > max_frame_length) {
+      throw std::length_error("MHDR message length exceeds max frame length");
+    }
+
+    return available < length ? 0 : length;
+  }
+
+  std::size_t min_read_size;
+  std::size_t max_read_size;
+  std::size_t max_frame_length;
+  std::size_t read_size;
+
+  std::vector<std::byte> buffer;
+  std::size_t read_index{0};
+  std::size_t write_index{0};
+};
+} // namespace cisco::common
+
+#endif
@@ -7,6 +7,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <span>
 #include <vector>
 
 namespace cisco::common {
@@ -306,7 +307,7 @@ serialize<MessageType>(const MessageType &message_type) {
 }
 
 template <>
-inline const MessageType deserialize(const std::vector<std::byte> &bytes) {
+inline const MessageType deserialize(const std::span<const std::byte> bytes) {
     return static_cast<MessageType>(deserialize<std::uint32_t>(bytes));
 }
 
@@ -17,6 +17,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <iterator>
+#include <span>
 #include <vector>
 
 namespace cisco::common {
@@ -74,29 +75,53 @@ class MHDR {
 
   protected:
   private:
-    std::uint32_t message_length;
-    MessageType message_type;
+    std::uint32_t message_length{0};
+    MessageType message_type{};
 };
 
 template <> inline const std::vector<std::byte> serialize(const MHDR &mhdr) {
-    std::vector<std::byte> result{};
+    ByteWriter writer{8};
+    writer.write(mhdr.getMessageLength());
+    writer.write(mhdr.getMessageType());
 
-    const auto length = serialize(mhdr.getMessageLength());
-    const auto type = serialize(mhdr.getMessageType());
+    return writer.release();
+}
 
-    std::move(length.cbegin(), length.cend(), std::back_inserter(result));
-    std::move(type.cbegin(), type.cend(), std::back_inserter(result));
+/**
+ * @brief MHDR 패킷 크기
+ *
+ */
+template <> inline constexpr std::size_t field_size_v<MHDR> = 8;
 
-    return result;
+/**
+ * @brief MHDR 기록
+ *
+ * @param mhdr
+ */
+template <> inline void ByteWriter::write<MHDR>(const MHDR &mhdr) {
+    write(mhdr.getMessageLength());
+    write(mhdr.getMessageType());
+}
+
+/**
+ * @brief 지금까지 기록된 본문 길이로 MHDR 메시지 길이를 갱신
+ *
+ * 버퍼 맨 앞에 MHDR 이 기록되어 있어야 한다.
+ *
+ * @param writer
+ */
+inline void patchMessageLength(ByteWriter &writer) {
+    writer.writeAt(0, static_cast<std::uint32_t>(writer.getPosition() -
+                                                 field_size_v<MHDR>));
 }
 
-template <> inline const MHDR deserialize(const std::vector<std::byte> &bytes) {
+template <>
+inline const MHDR deserialize(const std::span<const std::byte> bytes) {
+    ByteReader reader{bytes};
     MHDR mhdr{};
 
-    mhdr.setMessageLength(deserialize<std::uint32_t>(
-        std::vector<std::byte>{bytes.cbegin(), bytes.cbegin() + 4}));
-    mhdr.setMessageType(deserialize<MessageType>(
-        std::vector<std::byte>{bytes.cbegin() + 4, bytes.cbegin() + 8}));
+    mhdr.setMessageLength(reader.read<std::uint32_t>());
+    mhdr.setMessageType(reader.read<MessageType>());
 
     return mhdr;
 }
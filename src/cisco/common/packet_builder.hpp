@@ -0,0 +1,113 @@
+#pragma once
+
+#ifndef _CTM_CISCO_COMMON_PACKET_BUILDER_HPP_
+#define _CTM_CISCO_COMMON_PACKET_BUILDER_HPP_
+
+/*
+  수신 메시지 패킷 생성기
+  +------+------------+---------------+
+  | MHDR | Fixed Part | Floating Part |
+  +------+------------+---------------+
+  CG 가 보내는 메시지 (수신 전용이라 serialize 가 없는 메시지) 를 CTM 쪽
+  레이아웃 그대로 만든다. 고정 영역은 0 으로 채운 뒤 레이아웃의 오프셋에 직접
+  기록하고, 가변 영역은 호출 순서대로 뒤에 붙인다. 벤치마크 픽스처와 모의 CG
+  서버에서 사용한다.
+*/
+
+#include "./field_layout.hpp"
+#include "./message_type.hpp"
+#include "./mhdr.hpp"
+#include "./serializable.hpp"
+#include "./tag_value.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace cisco::common {
+/**
+ * @brief 수신 패킷 생성기
+ *
+ * @tparam T MessageLayout 이 정의된 수신 메시지
+ */
+template <typename T> class PacketBuilder {
+public:
+  /**
+   * @brief Construct a new Packet Builder object
+   *
+   * @param message_type
+   */
+  explicit PacketBuilder(const MessageType message_type) : writer{1'024} {
+    MHDR mhdr{};
+    mhdr.setMessageType(message_type);
+
+    writer.write(mhdr);
+    writer.writeBytes(
+        std::vector<std::byte>(MessageLayout<T>::size, std::byte{0}));
+  }
+
+  /**
+   * @brief 고정 영역 필드 기록
+   *
+   * @tparam Getter
+   * @param value
+   * @return PacketBuilder&
+   */
+  template <auto Getter>
+  PacketBuilder &
+  fixed(const typename detail::GetterTraits<decltype(Getter)>::value_type
+            value) {
+    writer.writeAt(field_size_v<MHDR> +
+                       MessageLayout<T>::template offsetOf<Getter>(),
+                   value);
+    return *this;
+  }
+
+  /**
+   * @brief 문자열 가변 필드 기록
+   *
+   * @param tag
+   * @param value
+   * @return PacketBuilder&
+   */
+  PacketBuilder &floating(const TagValue tag, const std::string_view value) {
+    writer.writeFloating(tag, value);
+    return *this;
+  }
+
+  /**
+   * @brief 정수 가변 필드 기록
+   *
+   * @tparam V
+   * @param tag
+   * @param value
+   * @return PacketBuilder&
+   */
+  template <typename V>
+    requires std::is_integral_v<V>
+  PacketBuilder &floating(const TagValue tag, const V value) {
+    writer.write(tag);
+    writer.write(static_cast<std::uint16_t>(field_size_v<V>));
+    writer.write(value);
+    return *this;
+  }
+
+  /**
+   * @brief MHDR 길이를 채우고 패킷을 꺼낸다
+   *
+   * @return std::vector<std::byte>
+   */
+  std::vector<std::byte> build() {
+    patchMessageLength(writer);
+    return writer.release();
+  }
+
+protected:
+private:
+  ByteWriter writer;
+};
+} // namespace cisco::common
+
+#endif
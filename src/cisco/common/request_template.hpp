@@ -0,0 +1,119 @@
+#pragma once
+
+#ifndef _CTM_CISCO_COMMON_REQUEST_TEMPLATE_HPP_
+#define _CTM_CISCO_COMMON_REQUEST_TEMPLATE_HPP_
+
+/*
+  미리 직렬화한 요청 템플릿
+  +------+------------+---------------+----------------+
+  | MHDR | Fixed Part | Floating Part | Trailing Field |
+  +------+------------+---------------+----------------+
+  세션마다 변하지 않는 바이트는 한 번만 직렬화하고, 전송할 때마다 바뀌는
+  필드(Invoke ID 등 고정 영역 필드, 마지막 가변 필드)만 버퍼에 덮어쓴다.
+  버퍼는 재사용하므로 전송 전 덮어쓰기는 메모리 복사 수준의 비용이다.
+*/
+
+#include "./field_layout.hpp"
+#include "./mhdr.hpp"
+#include "./serializable.hpp"
+#include "./tag_value.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace cisco::common {
+/**
+ * @brief 요청 메시지 템플릿
+ *
+ * @tparam T MessageLayout 이 정의된 요청 메시지
+ */
+template <typename T> class RequestTemplate {
+public:
+  /**
+   * @brief Construct a new Request Template object
+   *
+   * @param message 변하지 않는 필드가 채워진 원본 메시지
+   */
+  explicit RequestTemplate(const T &message) : buffer{serialize(message)} {
+    base_length = buffer.size();
+    // 마지막 가변 필드가 최대 길이여도 재할당이 없도록 미리 확보한다
+    buffer.reserve(base_length + 4 + max_floating_length);
+  }
+
+  /**
+   * @brief Destroy the Request Template object
+   *
+   */
+  ~RequestTemplate() = default;
+
+  /**
+   * @brief 고정 영역 필드를 덮어쓴다
+   *
+   * @tparam Getter 덮어쓸 필드의 Getter
+   * @param value
+   */
+  template <auto Getter>
+  void set(const typename detail::GetterTraits<decltype(Getter)>::value_type
+               value) {
+    constexpr std::size_t offset =
+        field_size_v<MHDR> + MessageLayout<T>::template offsetOf<Getter>();
+
+    detail::store(buffer.data() + offset, value);
+  }
+
+  /**
+   * @brief 템플릿 뒤에 붙는 가변 필드를 교체하고 MHDR 길이를 갱신한다
+   *
+   * @param tag
+   * @param value
+   */
+  void setFloating(const TagValue tag, const std::string_view value) {
+    const std::size_t length = std::min(value.size(), max_floating_length);
+
+    buffer.resize(base_length + 4 + length);
+    std::byte *data = buffer.data() + base_length;
+    detail::store(data, tag);
+    detail::store(data + 2, static_cast<std::uint16_t>(length));
+    std::memcpy(data + 4, value.data(), length);
+
+    detail::store(buffer.data(),
+                  static_cast<std::uint32_t>(buffer.size() -
+                                             field_size_v<MHDR>));
+  }
+
+  /**
+   * @brief 템플릿 뒤에 붙은 가변 필드를 제거한다
+   *
+   */
+  void clearFloating() {
+    buffer.resize(base_length);
+    detail::store(buffer.data(),
+                  static_cast<std::uint32_t>(base_length - field_size_v<MHDR>));
+  }
+
+  /**
+   * @brief 전송할 패킷
+   *
+   * @return std::span<const std::byte>
+   */
+  std::span<const std::byte> getPacket() const { return buffer; }
+
+protected:
+private:
+  /**
+   * @brief 가변 필드 최대 길이 (GED-188 문자열 필드 최대 길이)
+   *
+   */
+  static constexpr std::size_t max_floating_length = 64;
+
+  std::vector<std::byte> buffer;
+  std::size_t base_length{0};
+};
+} // namespace cisco::common
+
+#endif
@@ -8,8 +8,12 @@
 #include <cstdint>
 #include <cstring>
 #include <optional>
+#include <span>
+#include <stdexcept>
 #include <string>
 #include <string_view>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 namespace cisco::common {
@@ -138,72 +142,107 @@ serialize(const std::vector<std::byte> &value) {
 /**
  * @brief 패킷 -> 데이터 역직렬화 함수 템플릿
  *
+ * std::vector<std::byte> 는 std::span 으로 암시적 변환되므로 패킷 버퍼를 그대로
+ * 넘겨도 복사가 발생하지 않는다.
+ *
  * @tparam T
  * @param bytes
  * @return const T
  */
 template <typename T>
-inline const T deserialize(const std::vector<std::byte> &bytes);
+inline const T deserialize(const std::span<const std::byte> bytes);
+
+/**
+ * @brief 고정 길이 필드의 패킷상 크기 (bool 은 2바이트로 전송된다)
+ *
+ * @tparam T
+ */
+template <typename T> inline constexpr std::size_t field_size_v = sizeof(T);
+template <> inline constexpr std::size_t field_size_v<bool> = 2;
 
-template <> inline const bool deserialize(const std::vector<std::byte> &bytes) {
-  return static_cast<bool>(bytes.at(0) | bytes.at(1));
+namespace detail {
+/**
+ * @brief 역직렬화 대상 바이트 길이 검사
+ *
+ * @param bytes
+ * @param length
+ */
+inline void requireLength(const std::span<const std::byte> bytes,
+                          const std::size_t length) {
+  if (bytes.size() < length) {
+    throw std::out_of_range{"GED-188 packet is shorter than field length"};
+  }
 }
+} // namespace detail
 
-template <> inline const char deserialize(const std::vector<std::byte> &bytes) {
-  return static_cast<char>(bytes.at(0));
+template <>
+inline const bool deserialize(const std::span<const std::byte> bytes) {
+  detail::requireLength(bytes, 2);
+  return static_cast<bool>(bytes[0] | bytes[1]);
 }
 
 template <>
-inline const std::byte deserialize(const std::vector<std::byte> &bytes) {
-  return bytes.at(0);
+inline const char deserialize(const std::span<const std::byte> bytes) {
+  detail::requireLength(bytes, 1);
+  return static_cast<char>(bytes[0]);
 }
 
 template <>
-inline const std::int16_t deserialize(const std::vector<std::byte> &bytes) {
+inline const std::byte deserialize(const std::span<const std::byte> bytes) {
+  detail::requireLength(bytes, 1);
+  return bytes[0];
+}
+
+template <>
+inline const std::int16_t deserialize(const std::span<const std::byte> bytes) {
+  detail::requireLength(bytes, 2);
   std::int16_t result = 0;
 
-  result |= (static_cast<std::int32_t>(bytes.at(0)) << 8);
-  result |= (static_cast<std::int32_t>(bytes.at(1)));
+  result |= (static_cast<std::int32_t>(bytes[0]) << 8);
+  result |= (static_cast<std::int32_t>(bytes[1]));
 
   return result;
 }
 
 template <>
-inline const std::uint16_t deserialize(const std::vector<std::byte> &bytes) {
+inline const std::uint16_t deserialize(const std::span<const std::byte> bytes) {
+  detail::requireLength(bytes, 2);
   std::uint16_t result = 0;
 
-  result |= (static_cast<std::uint32_t>(bytes.at(0)) << 8);
-  result |= (static_cast<std::uint32_t>(bytes.at(1)));
+  result |= (static_cast<std::uint32_t>(bytes[0]) << 8);
+  result |= (static_cast<std::uint32_t>(bytes[1]));
 
   return result;
 }
 
 template <>
-inline const std::int32_t deserialize(const std::vector<std::byte> &bytes) {
+inline const std::int32_t deserialize(const std::span<const std::byte> bytes) {
+  detail::requireLength(bytes, 4);
   std::int32_t result = 0;
 
-  result |= (static_cast<std::int32_t>(bytes.at(0)) << 24);
-  result |= (static_cast<std::int32_t>(bytes.at(1)) << 16);
-  result |= (static_cast<std::int32_t>(bytes.at(2)) << 8);
-  result |= (static_cast<std::int32_t>(bytes.at(3)));
+  result |= (static_cast<std::int32_t>(bytes[0]) << 24);
+  result |= (static_cast<std::int32_t>(bytes[1]) << 16);
+  result |= (static_cast<std::int32_t>(bytes[2]) << 8);
+  result |= (static_cast<std::int32_t>(bytes[3]));
 
   return result;
 }
 
 template <>
-inline const std::uint32_t deserialize(const std::vector<std::byte> &bytes) {
+inline const std::uint32_t deserialize(const std::span<const std::byte> bytes) {
+  detail::requireLength(bytes, 4);
   std::uint32_t result = 0;
 
-  result |= (static_cast<std::uint32_t>(bytes.at(0)) << 24);
-  result |= (static_cast<std::uint32_t>(bytes.at(1)) << 16);
-  result |= (static_cast<std::uint32_t>(bytes.at(2)) << 8);
-  result |= (static_cast<std::uint32_t>(bytes.at(3)));
+  result |= (static_cast<std::uint32_t>(bytes[0]) << 24);
+  result |= (static_cast<std::uint32_t>(bytes[1]) << 16);
+  result |= (static_cast<std::uint32_t>(bytes[2]) << 8);
+  result |= (static_cast<std::uint32_t>(bytes[3]));
 
   return result;
 }
 
 template <>
-inline const std::string deserialize(const std::vector<std::byte> &bytes) {
+inline const std::string deserialize(const std::span<const std::byte> bytes) {
   std::string result{};
   result.resize(bytes.size());
 
@@ -214,9 +253,236 @@ inline const std::string deserialize(const std::vector<std::byte> &bytes) {
 
 template <>
 inline const std::vector<std::byte>
-deserialize(const std::vector<std::byte> &bytes) {
-  return bytes;
+deserialize(const std::span<const std::byte> bytes) {
+  return std::vector<std::byte>{bytes.begin(), bytes.end()};
 }
 
+/**
+ * @brief 패킷 읽기 커서
+ *
+ * 원본 패킷을 복사하지 않고 읽기 위치만 이동시키며 필드를 역직렬화한다.
+ * 남은 길이보다 긴 필드를 읽으려 하면 std::out_of_range 예외를 던진다.
+ */
+class ByteReader {
+public:
+  /**
+   * @brief Construct a new Byte Reader object
+   *
+   * @param bytes
+   */
+  explicit ByteReader(const std::span<const std::byte> bytes) : bytes(bytes) {}
+
+  /**
+   * @brief Destroy the Byte Reader object
+   *
+   */
+  ~ByteReader() = default;
+
+  /**
+   * @brief 고정 길이 필드를 읽고 커서를 이동
+   *
+   * @tparam T
+   * @return const T
+   */
+  template <typename T> const T read() {
+    return deserialize<T>(readBytes(field_size_v<T>));
+  }
+
+  /**
+   * @brief 지정한 길이만큼의 원본 바이트를 읽고 커서를 이동
+   *
+   * @param length
+   * @return std::span<const std::byte>
+   */
+  std::span<const std::byte> readBytes(const std::size_t length) {
+    detail::requireLength(bytes.subspan(position), length);
+
+    const std::span<const std::byte> result = bytes.subspan(position, length);
+    position += length;
+
+    return result;
+  }
+
+  /**
+   * @brief 지정한 길이만큼의 문자열을 읽고 커서를 이동
+   *
+   * @param length
+   * @return std::string_view
+   */
+  std::string_view readString(const std::size_t length) {
+    const std::span<const std::byte> result = readBytes(length);
+
+    return std::string_view{reinterpret_cast<const char *>(result.data()),
+                            result.size()};
+  }
+
+  /**
+   * @brief 지정한 길이만큼 커서를 이동
+   *
+   * @param length
+   */
+  void skip(const std::size_t length) { readBytes(length); }
+
+  /**
+   * @brief Get the Position object
+   *
+   * @return constexpr std::size_t
+   */
+  constexpr std::size_t getPosition() const { return position; }
+
+  /**
+   * @brief Get the Remaining object
+   *
+   * @return constexpr std::size_t
+   */
+  constexpr std::size_t getRemaining() const { return bytes.size() - position; }
+
+protected:
+private:
+  std::span<const std::byte> bytes;
+  std::size_t position = 0;
+};
+
+/**
+ * @brief 패킷 쓰기 커서
+ *
+ * 생성 시 전체 패킷 크기만큼 버퍼를 미리 확보하고, 각 필드를 해당 버퍼에 바로
+ * 기록한다. 크기를 정확히 계산했다면 패킷 하나당 할당은 한 번만 발생한다.
+ */
+class ByteWriter {
+public:
+  /**
+   * @brief Construct a new Byte Writer object
+   *
+   * @param capacity 미리 확보할 버퍼 크기
+   */
+  explicit ByteWriter(const std::size_t capacity) { buffer.reserve(capacity); }
+
+  /**
+   * @brief Destroy the Byte Writer object
+   *
+   */
+  ~ByteWriter() = default;
+
+  /**
+   * @brief 고정 길이 필드를 기록 (정수, 열거형은 빅 엔디안)
+   *
+   * @tparam T
+   * @param value
+   */
+  template <typename T> void write(const T &value) {
+    writeAt(extend(field_size_v<T>), value);
+  }
+
+  /**
+   * @brief 이미 기록된 위치의 고정 길이 필드를 덮어쓴다
+   *
+   * @tparam T
+   * @param position
+   * @param value
+   */
+  template <typename T>
+  void writeAt(const std::size_t position, const T &value) {
+    detail::requireLength(std::span<const std::byte>{buffer}.subspan(position),
+                          field_size_v<T>);
+
+    if constexpr (std::is_same_v<T, bool>) {
+      buffer[position] = static_cast<std::byte>(0x00);
+      buffer[position + 1] = static_cast<std::byte>(value);
+    } else if constexpr (std::is_enum_v<T>) {
+      writeAt(position, static_cast<std::underlying_type_t<T>>(value));
+    } else {
+      static_assert(std::is_integral_v<T> || std::is_same_v<T, std::byte>,
+                    "ByteWriter::writeAt requires a fixed size field type");
+
+      using Unsigned = std::make_unsigned_t<
+          std::conditional_t<std::is_same_v<T, std::byte>, std::uint8_t, T>>;
+      const Unsigned bits = static_cast<Unsigned>(value);
+      for (std::size_t i = 0; i < sizeof(T); i++) {
+        buffer[position + i] =
+            static_cast<std::byte>(bits >> ((sizeof(T) - 1 - i) * 8));
+      }
+    }
+  }
+
+  /**
+   * @brief 원본 바이트를 그대로 기록
+   *
+   * @param bytes
+   */
+  void writeBytes(const std::span<const std::byte> bytes) {
+    if (bytes.empty()) {
+      return;
+    }
+
+    std::memcpy(buffer.data() + extend(bytes.size()), bytes.data(),
+                bytes.size());
+  }
+
+  /**
+   * @brief 문자열을 널 문자 없이 기록
+   *
+   * @param value
+   */
+  void writeString(const std::string_view value) {
+    writeBytes(std::as_bytes(std::span{value.data(), value.size()}));
+  }
+
+  /**
+   * @brief 가변 필드 (Tag, Length, Data) 를 기록
+   *
+   * @tparam Tag
+   * @param tag
+   * @param value
+   */
+  template <typename Tag>
+  void writeFloating(const Tag tag, const std::string_view value) {
+    write(tag);
+    write(static_cast<std::uint16_t>(value.size()));
+    writeString(value);
+  }
+
+  /**
+   * @brief 가변 필드의 패킷상 크기
+   *
+   * @param value
+   * @return constexpr std::size_t
+   */
+  static constexpr std::size_t floatingSize(const std::string_view value) {
+    return 4 + value.size();
+  }
+
+  /**
+   * @brief Get the Position object
+   *
+   * @return std::size_t
+   */
+  std::size_t getPosition() const { return buffer.size(); }
+
+  /**
+   * @brief 기록한 버퍼의 소유권을 넘긴다
+   *
+   * @return std::vector<std::byte>
+   */
+  std::vector<std::byte> release() { return std::move(buffer); }
+
+protected:
+private:
+  /**
+   * @brief 버퍼를 늘리고 늘어난 영역의 시작 위치를 반환
+   *
+   * @param length
+   * @return std::size_t
+   */
+  std::size_t extend(const std::size_t length) {
+    const std::size_t position = buffer.size();
+    buffer.resize(position + length);
+
+    return position;
+  }
+
+  std::vector<std::byte> buffer{};
+};
+
 } // namespace cisco::common
 #endif
\ No newline at end of file
@@ -7,6 +7,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <span>
 #include <vector>
 
 namespace cisco::common {
@@ -306,7 +307,7 @@ inline const std::vector<std::byte> serialize(const TagValue &tag_value) {
 }
 
 template <>
-inline const TagValue deserialize(const std::vector<std::byte> &bytes) {
+inline const TagValue deserialize(const std::span<const std::byte> bytes) {
     return static_cast<TagValue>(deserialize<std::uint16_t>(bytes));
 }
 } // namespace cisco::common
@@ -3,13 +3,17 @@
 #ifndef _CTM_CISCO_CONTROL_QUERY_AGENT_STATE_CONF_HPP_
 #define _CTM_CISCO_CONTROL_QUERY_AGENT_STATE_CONF_HPP_
 
+#include "../common/field_layout.hpp"
+#include "../common/fixed_string.hpp"
 #include "../common/floating_data.hpp"
+#include "../common/floating_layout.hpp"
 #include "../common/mhdr.hpp"
 
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
 #include <optional>
+#include <span>
 #include <string>
 #include <string_view>
 #include <vector>
@@ -99,24 +103,22 @@ public:
   /**
    * @brief Get the Agent ID object
    *
-   * @return const std::string
+   * @return std::string_view
    */
-  const std::string getAgentID() const { return agent_id.value_or(""); }
+  std::string_view getAgentID() const { return agent_id.view(); }
   /**
    * @brief Get the Agent Extension object
    *
-   * @return const std::string
+   * @return std::string_view
    */
-  const std::string getAgentExtension() const {
-    return agent_extension.value_or("");
-  }
+  std::string_view getAgentExtension() const { return agent_extension.view(); }
   /**
    * @brief Get the Agent Instrument object
    *
-   * @return const std::string
+   * @return std::string_view
    */
-  const std::string getAgentInstrument() const {
-    return agent_instrument.value_or("");
+  std::string_view getAgentInstrument() const {
+    return agent_instrument.view();
   }
   /**
    * @brief Get the Skill Group Number object
@@ -258,7 +260,7 @@ public:
    * @param agent_id
    */
   void setAgentID(const std::string_view &agent_id) {
-    this->agent_id = agent_id.data();
+    this->agent_id = agent_id;
   }
   /**
    * @brief Set the Agent Extension object
@@ -266,7 +268,7 @@ public:
    * @param agent_extension
    */
   void setAgentExtension(const std::string_view &agent_extension) {
-    this->agent_extension = agent_extension.data();
+    this->agent_extension = agent_extension;
   }
   /**
    * @brief Set the Agent Instrument object
@@ -274,7 +276,7 @@ public:
    * @param agent_instrument
    */
   void setAgentInstrument(const std::string_view &agent_instrument) {
-    this->agent_instrument = agent_instrument.data();
+    this->agent_instrument = agent_instrument;
   }
   /**
    * @brief Set the Skill Group Number object
@@ -328,21 +330,21 @@ public:
 protected:
 private:
   // 고정영역
-  common::MHDR mhdr;
-  std::uint32_t invoke_id;
-  std::uint16_t agent_state;
-  std::uint16_t num_skill_groups;
-  std::int32_t mrd_id;
-  std::uint32_t agent_availability_status;
-  std::uint32_t num_tasks;
-  std::uint16_t agent_mode;
-  std::uint32_t max_task_limit;
-  std::int32_t icm_agent_id;
-  std::int32_t department_id;
+  common::MHDR mhdr{};
+  std::uint32_t invoke_id{};
+  std::uint16_t agent_state{};
+  std::uint16_t num_skill_groups{};
+  std::int32_t mrd_id{};
+  std::uint32_t agent_availability_status{};
+  std::uint32_t num_tasks{};
+  std::uint16_t agent_mode{};
+  std::uint32_t max_task_limit{};
+  std::int32_t icm_agent_id{};
+  std::int32_t department_id{};
   // 가변 영역
-  std::optional<std::string> agent_id;
-  std::optional<std::string> agent_extension;
-  std::optional<std::string> agent_instrument;
+  common::AgentIDString agent_id;
+  common::AgentExtensionString agent_extension;
+  common::AgentInstrumentString agent_instrument;
   std::optional<std::uint32_t> skill_group_number;
   std::optional<std::uint32_t> skill_group_id;
   std::optional<std::uint16_t> skill_group_priority;
@@ -352,139 +354,86 @@ private:
 };
 } // namespace cisco::control
 
+namespace cisco::common {
+/**
+ * @brief QUERY_AGENT_STATE_CONF 고정 영역 레이아웃
+ *
+ */
 template <>
-inline const cisco::control::QueryAgentStateConf
-cisco::common::deserialize(const std::vector<std::byte> &bytes) {
-  cisco::control::QueryAgentStateConf query_agent_state_conf;
-
-  size_t packet_index = 0;
-  size_t field_size = 0;
-
-  field_size = 8;
-  query_agent_state_conf.setMHDR(deserialize<common::MHDR>(
-      std::vector<std::byte>{bytes.cbegin() + packet_index,
-                             bytes.cbegin() + packet_index + field_size}));
-  packet_index += field_size;
-
-  field_size = 4;
-  query_agent_state_conf.setInvokeID(deserialize<std::uint32_t>(
-      std::vector<std::byte>{bytes.cbegin() + packet_index,
-                             bytes.cbegin() + packet_index + field_size}));
-  packet_index += field_size;
-
-  field_size = 2;
-  query_agent_state_conf.setAgentState(deserialize<std::uint16_t>(
-      std::vector<std::byte>{bytes.cbegin() + packet_index,
-                             bytes.cbegin() + packet_index + field_size}));
-  packet_index += field_size;
-
-  query_agent_state_conf.setNumSkillGroups(deserialize<std::uint16_t>(
-      std::vector<std::byte>{bytes.cbegin() + packet_index,
-                             bytes.cbegin() + packet_index + field_size}));
-  packet_index += field_size;
-
-  field_size = 4;
-  query_agent_state_conf.setMRDID(deserialize<std::int32_t>(
-      std::vector<std::byte>{bytes.cbegin() + packet_index,
-                             bytes.cbegin() + packet_index + field_size}));
-  packet_index += field_size;
-
-  query_agent_state_conf.setAgentAvailabilityStatus(deserialize<std::uint32_t>(
-      std::vector<std::byte>{bytes.cbegin() + packet_index,
-                             bytes.cbegin() + packet_index + field_size}));
-  packet_index += field_size;
-
-  field_size = 4;
-  query_agent_state_conf.setNumTasks(deserialize<std::uint32_t>(
-      std::vector<std::byte>{bytes.cbegin() + packet_index,
-                             bytes.cbegin() + packet_index + field_size}));
-  packet_index += field_size;
-
-  field_size = 2;
-  query_agent_state_conf.setAgentMode(deserialize<std::uint16_t>(
-      std::vector<std::byte>{bytes.cbegin() + packet_index,
-                             bytes.cbegin() + packet_index + field_size}));
-  packet_index += field_size;
-
-  field_size = 4;
-  query_agent_state_conf.setMaxTaskLimit(deserialize<std::uint32_t>(
-      std::vector<std::byte>{bytes.cbegin() + packet_index,
-                             bytes.cbegin() + packet_index + field_size}));
-  packet_index += field_size;
+struct MessageLayout<control::QueryAgentStateConf>
+    : FieldLayout<
+          Field<&control::QueryAgentStateConf::getInvokeID,
+                &control::QueryAgentStateConf::setInvokeID>,
+          Field<&control::QueryAgentStateConf::getAgentState,
+                &control::QueryAgentStateConf::setAgentState>,
+          Field<&control::QueryAgentStateConf::getNumSkillGroups,
+                &control::QueryAgentStateConf::setNumSkillGroups>,
+          Field<&control::QueryAgentStateConf::getMRDID,
+                &control::QueryAgentStateConf::setMRDID>,
+          Field<&control::QueryAgentStateConf::getAgentAvailabilityStatus,
+                &control::QueryAgentStateConf::setAgentAvailabilityStatus>,
+          Field<&control::QueryAgentStateConf::getNumTasks,
+                &control::QueryAgentStateConf::setNumTasks>,
+          Field<&control::QueryAgentStateConf::getAgentMode,
+                &control::QueryAgentStateConf::setAgentMode>,
+          Field<&control::QueryAgentStateConf::getMaxTaskLimit,
+                &control::QueryAgentStateConf::setMaxTaskLimit>,
+          Field<&control::QueryAgentStateConf::getICMAgentID,
+                &control::QueryAgentStateConf::setICMAgentID>,
+          Field<&control::QueryAgentStateConf::getDepartmentID,
+                &control::QueryAgentStateConf::setDepartmentID>> {};
 
-  query_agent_state_conf.setICMAgentID(deserialize<std::int32_t>(
-      std::vector<std::byte>{bytes.cbegin() + packet_index,
-                             bytes.cbegin() + packet_index + field_size}));
-  packet_index += field_size;
-
-  query_agent_state_conf.setDepartmentID(deserialize<std::int32_t>(
-      std::vector<std::byte>{bytes.cbegin() + packet_index,
-                             bytes.cbegin() + packet_index + field_size}));
-  packet_index += field_size;
-
-  // 가변 데이터 파싱
-  while (packet_index < query_agent_state_conf.getMHDR().getMessageLength()) {
-    const cisco::common::FloatingData floating_data =
-        cisco::common::deserialize<cisco::common::FloatingData>(
-            std::vector<std::byte>{bytes.cbegin() + packet_index,
-                                   bytes.cend()});
-    packet_index += 4 + floating_data.getData().size();
-
-    switch (floating_data.getTag()) {
-    case cisco::common::TagValue::AGENT_ID_TAG: {
-      std::string agent_id;
-      agent_id.resize(floating_data.getData().size());
-      std::memcpy(agent_id.data(), floating_data.getData().data(),
-                  floating_data.getData().size());
+/**
+ * @brief QUERY_AGENT_STATE_CONF 가변 영역 레이아웃
+ *
+ */
+template <>
+struct MessageFloatingLayout<control::QueryAgentStateConf>
+    : FloatingLayout<
+          control::QueryAgentStateConf,
+          FloatingField<TagValue::AGENT_ID_TAG,
+                        &control::QueryAgentStateConf::setAgentID>,
+          FloatingField<TagValue::AGENT_EXTENSION_TAG,
+                        &control::QueryAgentStateConf::setAgentExtension>,
+          FloatingField<TagValue::AGENT_INSTRUMENT_TAG,
+                        &control::QueryAgentStateConf::setAgentInstrument>,
+          FloatingField<TagValue::SKILL_GROUP_NUMBER_TAG,
+                        &control::QueryAgentStateConf::setSkillGroupNumber>,
+          FloatingField<TagValue::SKILL_GROUP_ID_TAG,
+                        &control::QueryAgentStateConf::setSkillGroupID>,
+          FloatingField<TagValue::SKILL_GROUP_PRIORITY_TAG,
+                        &control::QueryAgentStateConf::setSkillGroupPriority>,
+          FloatingField<TagValue::SKILL_GROUP_STATE_TAG,
+                        &control::QueryAgentStateConf::setSkillGroupState>,
+          FloatingField<TagValue::INTERNAL_AGENT_STATE_TAG,
+                        &control::QueryAgentStateConf::setInternalAgentState>,
+          FloatingField<TagValue::MAX_BEYOND_TASK_LIMIT_TAG,
+                        &control::QueryAgentStateConf::setMaxBeyondTaskLimit>> {};
+} // namespace cisco::common
 
-      query_agent_state_conf.setAgentID(agent_id);
-    } break;
-    case cisco::common::TagValue::AGENT_EXTENSION_TAG: {
-      std::string agent_extension;
-      agent_extension.resize(floating_data.getData().size());
-      std::memcpy(agent_extension.data(), floating_data.getData().data(),
-                  floating_data.getData().size());
+template <>
+inline const cisco::control::QueryAgentStateConf
+cisco::common::deserialize(const std::span<const std::byte> bytes,
+                           const DecodeMask mask) {
+  cisco::control::QueryAgentStateConf query_agent_state_conf;
+  ByteReader reader{bytes};
 
-      query_agent_state_conf.setAgentExtension(agent_extension);
-    } break;
-    case cisco::common::TagValue::AGENT_INSTRUMENT_TAG: {
-      std::string agent_instrument;
-      agent_instrument.resize(floating_data.getData().size());
-      std::memcpy(agent_instrument.data(), floating_data.getData().data(),
-                  floating_data.getData().size());
+  query_agent_state_conf.setMHDR(reader.read<common::MHDR>());
+  MessageLayout<control::QueryAgentStateConf>::decode(
+      reader, query_agent_state_conf, mask.fixed);
 
-      query_agent_state_conf.setAgentInstrument(agent_instrument);
-    } break;
-    case cisco::common::TagValue::SKILL_GROUP_NUMBER_TAG: {
-      query_agent_state_conf.setSkillGroupNumber(
-          deserialize<std::uint32_t>(floating_data.getData()));
-    } break;
-    case cisco::common::TagValue::SKILL_GROUP_ID_TAG: {
-      query_agent_state_conf.setSkillGroupID(
-          deserialize<std::uint32_t>(floating_data.getData()));
-    } break;
-    case cisco::common::TagValue::SKILL_GROUP_PRIORITY_TAG: {
-      query_agent_state_conf.setSkillGroupPriority(
-          deserialize<std::uint16_t>(floating_data.getData()));
-    } break;
-    case cisco::common::TagValue::SKILL_GROUP_STATE_TAG: {
-      query_agent_state_conf.setSkillGroupState(
-          deserialize<std::uint16_t>(floating_data.getData()));
-    } break;
-    case cisco::common::TagValue::INTERNAL_AGENT_STATE_TAG: {
-      query_agent_state_conf.setInternalAgentState(
-          deserialize<std::uint16_t>(floating_data.getData()));
-    } break;
-    case cisco::common::TagValue::MAX_BEYOND_TASK_LIMIT_TAG: {
-      query_agent_state_conf.setMaxBeyondTaskLimit(
-          deserialize<std::uint32_t>(floating_data.getData()));
-    } break;
-    default:
-      break;
-    }
-  }
+  // 가변 데이터 파싱 (MHDR 길이에는 MHDR 8바이트가 포함되지 않는다)
+  MessageFloatingLayout<control::QueryAgentStateConf>::decode(
+      reader, query_agent_state_conf.getMHDR().getMessageLength() + 8,
+      query_agent_state_conf, mask.floating);
 
   return query_agent_state_conf;
 }
 
+template <>
+inline const cisco::control::QueryAgentStateConf
+cisco::common::deserialize(const std::span<const std::byte> bytes) {
+  return deserialize<cisco::control::QueryAgentStateConf>(bytes, DecodeMask::all());
+}
+
 #endif
\ No newline at end of file
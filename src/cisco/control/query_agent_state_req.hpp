@@ -3,6 +3,8 @@
 #ifndef _CTM_CISCO_CONTROL_QUERY_AGENT_STATE_REQ_HPP_
 #define _CTM_CISCO_CONTROL_QUERY_AGENT_STATE_REQ_HPP_
 
+#include "../common/field_layout.hpp"
+#include "../common/fixed_string.hpp"
 #include "../common/floating_data.hpp"
 #include "../common/mhdr.hpp"
 #include "../common/serializable.hpp"
@@ -57,23 +59,26 @@ public:
   /**
    * @brief Get the Agent Extension object
    *
-   * @return const std::optional<std::string>
+   * @return const std::optional<common::AgentExtensionString>&
    */
-  const std::optional<std::string> getAgentExtension() const {
+  const std::optional<common::AgentExtensionString> &getAgentExtension() const {
     return agent_extension;
   }
   /**
    * @brief Get the Agent ID object
    *
-   * @return const std::optional<std::string>
+   * @return const std::optional<common::AgentIDString>&
    */
-  const std::optional<std::string> getAgentID() const { return agent_id; }
+  const std::optional<common::AgentIDString> &getAgentID() const {
+    return agent_id;
+  }
   /**
    * @brief Get the Agent Instrument object
    *
-   * @return const std::optional<std::string>
+   * @return const std::optional<common::AgentInstrumentString>&
    */
-  const std::optional<std::string> getAgentInstrument() const {
+  const std::optional<common::AgentInstrumentString> &
+  getAgentInstrument() const {
     return agent_instrument;
   }
 
@@ -113,7 +118,7 @@ public:
    * @param agent_extension
    */
   void setAgentExtension(const std::string_view &agent_extension) {
-    this->agent_extension = agent_extension.data();
+    this->agent_extension = agent_extension;
   }
   /**
    * @brief Set the Agent ID object
@@ -121,7 +126,7 @@ public:
    * @param agent_id
    */
   void setAgentID(const std::string_view &agent_id) {
-    this->agent_id = agent_id.data();
+    this->agent_id = agent_id;
   }
   /**
    * @brief Set the Agent Instrument object
@@ -135,65 +140,81 @@ public:
 protected:
 private:
   // 고정 데이터 영역
-  common::MHDR mhdr;
-  std::uint32_t invoke_id;
-  std::uint32_t peripheral_id;
-  std::int32_t mrd_id;
-  std::int32_t icm_agent_id;
+  common::MHDR mhdr{};
+  std::uint32_t invoke_id{};
+  std::uint32_t peripheral_id{};
+  std::int32_t mrd_id{};
+  std::int32_t icm_agent_id{};
   // 가변 데이터 영역
-  std::optional<std::string> agent_extension;
-  std::optional<std::string> agent_id;
-  std::optional<std::string> agent_instrument;
+  std::optional<common::AgentExtensionString> agent_extension;
+  std::optional<common::AgentIDString> agent_id;
+  std::optional<common::AgentInstrumentString> agent_instrument;
 };
 } // namespace cisco::control
 
+namespace cisco::common {
+/**
+ * @brief QUERY_AGENT_STATE_REQ 고정 영역 레이아웃
+ *
+ */
+template <>
+struct MessageLayout<control::QueryAgentStateReq>
+    : FieldLayout<
+          Field<&control::QueryAgentStateReq::getInvokeID,
+                &control::QueryAgentStateReq::setInvokeID>,
+          Field<&control::QueryAgentStateReq::getPeripheralID,
+                &control::QueryAgentStateReq::setPeripheralID>,
+          Field<&control::QueryAgentStateReq::getMRDID,
+                &control::QueryAgentStateReq::setMRDID>,
+          Field<&control::QueryAgentStateReq::getICMAgentID,
+                &control::QueryAgentStateReq::setICMAgentID>> {};
+} // namespace cisco::common
+
 template <>
 inline const std::vector<std::byte> cisco::common::serialize(
     const cisco::control::QueryAgentStateReq &query_agent_state_req) {
-  std::vector<std::byte> body{};
-
-  std::vector<std::vector<std::byte>> members{};
-
-  members.emplace_back(serialize(query_agent_state_req.getInvokeID()));
-  members.emplace_back(serialize(query_agent_state_req.getPeripheralID()));
-  members.emplace_back(serialize(query_agent_state_req.getMRDID()));
-  members.emplace_back(serialize(query_agent_state_req.getICMAgentID()));
-
-  if (query_agent_state_req.getAgentExtension().has_value()) {
-    cisco::common::FloatingData agent_extension{};
-    agent_extension.setTag(TagValue::AGENT_EXTENSION_TAG);
-    agent_extension.setData(
-        query_agent_state_req.getAgentExtension().value_or(""));
-    members.emplace_back(serialize(agent_extension));
+  const std::optional<AgentExtensionString> &agent_extension =
+      query_agent_state_req.getAgentExtension();
+  const std::optional<AgentIDString> &agent_id =
+      query_agent_state_req.getAgentID();
+  const std::optional<AgentInstrumentString> &agent_instrument =
+      query_agent_state_req.getAgentInstrument();
+
+  // 패킷 전체 길이를 미리 계산해 버퍼를 한 번만 할당한다
+  std::size_t length =
+      field_size_v<MHDR> + MessageLayout<control::QueryAgentStateReq>::size;
+  if (agent_extension.has_value()) {
+    length += ByteWriter::floatingSize(agent_extension.value());
+  }
+  if (agent_id.has_value()) {
+    length += ByteWriter::floatingSize(agent_id.value());
+  }
+  if (agent_instrument.has_value()) {
+    length += ByteWriter::floatingSize(agent_instrument.value());
   }
 
-  if (query_agent_state_req.getAgentID().has_value()) {
+  ByteWriter writer{length};
+  writer.write(query_agent_state_req.getMHDR());
+  MessageLayout<control::QueryAgentStateReq>::encode(writer,
+                                                     query_agent_state_req);
 
-    cisco::common::FloatingData agent_id{};
-    agent_id.setTag(TagValue::AGENT_ID_TAG);
-    agent_id.setData(query_agent_state_req.getAgentID().value_or(""));
-    members.emplace_back(serialize(agent_id));
+  if (agent_extension.has_value()) {
+    writer.writeFloating(TagValue::AGENT_EXTENSION_TAG,
+                         agent_extension.value());
   }
 
-  if (query_agent_state_req.getAgentInstrument().has_value()) {
-    cisco::common::FloatingData agent_instrument{};
-    agent_instrument.setTag(TagValue::AGENT_INSTRUMENT_TAG);
-    agent_instrument.setData(
-        query_agent_state_req.getAgentInstrument().value_or(""));
-    members.emplace_back(serialize(agent_instrument));
+  if (agent_id.has_value()) {
+    writer.writeFloating(TagValue::AGENT_ID_TAG, agent_id.value());
   }
 
-  for (const std::vector<std::byte> &member : members) {
-    std::move(member.cbegin(), member.cend(), std::back_inserter(body));
+  if (agent_instrument.has_value()) {
+    writer.writeFloating(TagValue::AGENT_INSTRUMENT_TAG,
+                         agent_instrument.value());
   }
 
-  MHDR mhdr = query_agent_state_req.getMHDR();
-  mhdr.setMessageLength(body.size());
-
-  std::vector<std::byte> result = serialize(mhdr);
-  std::move(body.cbegin(), body.cend(), std::back_inserter(result));
+  patchMessageLength(writer);
 
-  return result;
+  return writer.release();
 }
 
 #endif
\ No newline at end of file
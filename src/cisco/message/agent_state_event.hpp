@@ -3,7 +3,10 @@
 #ifndef _CTM_CISCO_MESSAGE_AGENT_STATE_EVENT_HPP_
 #define _CTM_CISCO_MESSAGE_AGENT_STATE_EVENT_HPP_
 
+#include "../common/field_layout.hpp"
+#include "../common/fixed_string.hpp"
 #include "../common/floating_data.hpp"
+#include "../common/floating_layout.hpp"
 #include "../common/mhdr.hpp"
 #include "../common/serializable.hpp"
 
@@ -11,6 +14,7 @@
 #include <cstdint>
 #include <cstring>
 #include <optional>
+#include <span>
 #include <string>
 #include <string_view>
 #include <vector>
@@ -65,40 +69,36 @@ public:
   /**
    * @brief Get the CTI Client Signature object
    *
-   * @return const std::string
+   * @return std::string_view
    */
-  const std::string getCTIClientSignature() const {
-    return this->cti_client_signature->c_str();
+  std::string_view getCTIClientSignature() const {
+    return cti_client_signature.view();
   }
   /**
    * @brief Get the Agent ID object
    *
-   * @return const std::string
+   * @return std::string_view
    */
-  const std::string getAgentID() const { return this->agent_id->data(); }
+  std::string_view getAgentID() const { return agent_id.view(); }
   /**
    * @brief Get the Agent Extension object
    *
-   * @return const std::string
+   * @return std::string_view
    */
-  const std::string getAgentExtension() const {
-    return this->agent_extension->data();
-  }
+  std::string_view getAgentExtension() const { return agent_extension.view(); }
   /**
    * @brief Get the Active Terminal object
    *
-   * @return const std::string
+   * @return std::string_view
    */
-  const std::string getActiveTerminal() const {
-    return this->active_terminal->data();
-  }
+  std::string_view getActiveTerminal() const { return active_terminal.view(); }
   /**
    * @brief Get the Agent Instrument object
    *
-   * @return const std::string
+   * @return std::string_view
    */
-  const std::string getAgentInstrument() const {
-    return this->agent_instrument->data();
+  std::string_view getAgentInstrument() const {
+    return agent_instrument.view();
   }
   /**
    * @brief Get the Duration object
@@ -321,7 +321,7 @@ public:
    * @param cti_client_signature
    */
   void setCTIClientSignature(const std::string_view &cti_client_signature) {
-    this->cti_client_signature = cti_client_signature.data();
+    this->cti_client_signature = cti_client_signature;
   }
   /**
    * @brief Set the Agent ID object
@@ -329,7 +329,7 @@ public:
    * @param agent_id
    */
   void setAgentID(const std::string_view &agent_id) {
-    this->agent_id = agent_id.data();
+    this->agent_id = agent_id;
   }
   /**
    * @brief Set the Agent Extension object
@@ -337,7 +337,7 @@ public:
    * @param agent_extension
    */
   void setAgentExtension(const std::string_view &agent_extension) {
-    this->agent_extension = agent_extension.data();
+    this->agent_extension = agent_extension;
   }
   /**
    * @brief Set the Active Terminal object
@@ -345,7 +345,7 @@ public:
    * @param active_terminal
    */
   void setActiveTerminal(const std::string_view &active_terminal) {
-    this->active_terminal = active_terminal.data();
+    this->active_terminal = active_terminal;
   }
   /**
    * @brief Set the Agent Instrument object
@@ -353,7 +353,7 @@ public:
    * @param agent_instrument
    */
   void setAgentInstrument(const std::string_view &agent_instrument) {
-    this->agent_instrument = agent_instrument.data();
+    this->agent_instrument = agent_instrument;
   }
   /**
    * @brief Set the Duration object
@@ -421,32 +421,32 @@ public:
 protected:
 private:
   // 고정 영역 데이터
-  common::MHDR mhdr;
-  std::uint32_t monitor_id;
-  std::uint32_t peripheral_id;
-  std::uint32_t session_id;
-  std::uint16_t peripheral_type;
-  std::uint16_t skill_group_state;
-  std::uint32_t state_duration;
-  std::uint32_t skill_group_number;
-  std::uint32_t skill_group_id;
-  std::uint16_t skill_group_priority;
-  std::uint16_t agent_state;
-  std::uint16_t event_reason_code;
-  std::int32_t mrd_id;
-  std::uint32_t num_task;
-  std::uint16_t agent_mode;
-  std::uint32_t max_task_limit;
-  std::int32_t icm_agent_id;
-  std::uint32_t agent_availability_status;
-  std::uint16_t num_flt_skill_groups;
-  std::int32_t department_id;
+  common::MHDR mhdr{};
+  std::uint32_t monitor_id{};
+  std::uint32_t peripheral_id{};
+  std::uint32_t session_id{};
+  std::uint16_t peripheral_type{};
+  std::uint16_t skill_group_state{};
+  std::uint32_t state_duration{};
+  std::uint32_t skill_group_number{};
+  std::uint32_t skill_group_id{};
+  std::uint16_t skill_group_priority{};
+  std::uint16_t agent_state{};
+  std::uint16_t event_reason_code{};
+  std::int32_t mrd_id{};
+  std::uint32_t num_task{};
+  std::uint16_t agent_mode{};
+  std::uint32_t max_task_limit{};
+  std::int32_t icm_agent_id{};
+  std::uint32_t agent_availability_status{};
+  std::uint16_t num_flt_skill_groups{};
+  std::int32_t department_id{};
   // 가변 영역 데이터
-  std::optional<std::string> cti_client_signature;
-  std::optional<std::string> agent_id;
-  std::optional<std::string> agent_extension;
-  std::optional<std::string> active_terminal;
-  std::optional<std::string> agent_instrument;
+  common::ClientSignatureString cti_client_signature;
+  common::AgentIDString agent_id;
+  common::AgentExtensionString agent_extension;
+  common::AgentInstrumentString active_terminal;
+  common::AgentInstrumentString agent_instrument;
   std::optional<std::uint32_t> duration;
   std::optional<std::uint16_t> next_agent_state;
   std::optional<std::uint32_t> direction;
@@ -458,174 +458,111 @@ private:
 };
 } // namespace cisco::message
 
+namespace cisco::common {
+/**
+ * @brief AGENT_STATE_EVENT 고정 영역 레이아웃
+ *
+ */
+template <>
+struct MessageLayout<message::AgentStateEvent>
+    : FieldLayout<
+          Field<&message::AgentStateEvent::getMonitorID,
+                &message::AgentStateEvent::setMonitorID>,
+          Field<&message::AgentStateEvent::getPeripheralID,
+                &message::AgentStateEvent::setPeripheralID>,
+          Field<&message::AgentStateEvent::getSessionID,
+                &message::AgentStateEvent::setSessionID>,
+          Field<&message::AgentStateEvent::getPeripheralType,
+                &message::AgentStateEvent::setPeripheralType>,
+          Field<&message::AgentStateEvent::getSkillGroupState,
+                &message::AgentStateEvent::setSkillGroupState>,
+          Field<&message::AgentStateEvent::getStateDuration,
+                &message::AgentStateEvent::setStateDuration>,
+          Field<&message::AgentStateEvent::getSkillGroupNumber,
+                &message::AgentStateEvent::setSkillGroupNumber>,
+          Field<&message::AgentStateEvent::getSkillGroupID,
+                &message::AgentStateEvent::setSkillGroupID>,
+          Field<&message::AgentStateEvent::getSkillGroupPriority,
+                &message::AgentStateEvent::setSkillGroupPriority>,
+          Field<&message::AgentStateEvent::getAgentState,
+                &message::AgentStateEvent::setAgentState>,
+          Field<&message::AgentStateEvent::getEventReasonCode,
+                &message::AgentStateEvent::setEventReasonCode>,
+          Field<&message::AgentStateEvent::getMRDID,
+                &message::AgentStateEvent::setMRDID>,
+          Field<&message::AgentStateEvent::getNumTask,
+                &message::AgentStateEvent::setNumTask>,
+          Field<&message::AgentStateEvent::getAgentMode,
+                &message::AgentStateEvent::setAgentMode>,
+          Field<&message::AgentStateEvent::getMaxTaskLimit,
+                &message::AgentStateEvent::setMaxTaskLimit>,
+          Field<&message::AgentStateEvent::getICMAgentID,
+                &message::AgentStateEvent::setICMAgentID>,
+          Field<&message::AgentStateEvent::getAgentAvailabilityStatus,
+                &message::AgentStateEvent::setAgentAvailabilityStatus>,
+          Field<&message::AgentStateEvent::getNumFltSkillGroups,
+                &message::AgentStateEvent::setNumFltSkillGroups>,
+          Field<&message::AgentStateEvent::getDepartmentID,
+                &message::AgentStateEvent::setDepartmentID>> {};
+
+/**
+ * @brief AGENT_STATE_EVENT 가변 영역 레이아웃
+ *
+ */
+template <>
+struct MessageFloatingLayout<message::AgentStateEvent>
+    : FloatingLayout<
+          message::AgentStateEvent,
+          FloatingField<TagValue::CTI_CLIENT_SIGNATURE_TAG,
+                        &message::AgentStateEvent::setCTIClientSignature>,
+          FloatingField<TagValue::AGENT_ID_TAG,
+                        &message::AgentStateEvent::setAgentID>,
+          FloatingField<TagValue::AGENT_EXTENSION_TAG,
+                        &message::AgentStateEvent::setAgentExtension>,
+          FloatingField<TagValue::FLT_TERM_DEVICE_NAME,
+                        &message::AgentStateEvent::setActiveTerminal>,
+          FloatingField<TagValue::AGENT_INSTRUMENT_TAG,
+                        &message::AgentStateEvent::setAgentInstrument>,
+          FloatingField<TagValue::DURATION_TAG,
+                        &message::AgentStateEvent::setDuration>,
+          FloatingField<TagValue::EXT_AGENT_STATE_TAG,
+                        &message::AgentStateEvent::setAgentState>,
+          FloatingField<TagValue::DIRECTION_TAG,
+                        &message::AgentStateEvent::setDirection>,
+          FloatingField<TagValue::SKILL_GROUP_NUMBER_TAG,
+                        &message::AgentStateEvent::setFltSkillGroupNumber>,
+          FloatingField<TagValue::SKILL_GROUP_ID_TAG,
+                        &message::AgentStateEvent::setFltSkillGroupID>,
+          FloatingField<TagValue::SKILL_GROUP_PRIORITY_TAG,
+                        &message::AgentStateEvent::setFltSkillGroupPriority>,
+          FloatingField<TagValue::SKILL_GROUP_STATE_TAG,
+                        &message::AgentStateEvent::setFltSkillGroupState>,
+          FloatingField<TagValue::MAX_BEYOND_TASK_LIMIT_TAG,
+                        &message::AgentStateEvent::setMaxBeyondTaskLimit>> {};
+} // namespace cisco::common
+
 template <>
 inline const cisco::message::AgentStateEvent
-cisco::common::deserialize(const std::vector<std::byte> &bytes) {
+cisco::common::deserialize(const std::span<const std::byte> bytes,
+                           const DecodeMask mask) {
   cisco::message::AgentStateEvent result{};
-
-  size_t packet_index = 0;
-  size_t field_size = 0;
+  cisco::common::ByteReader reader{bytes};
 
   // 고정 영역
-  field_size = 8;
-  result.setMHDR(cisco::common::deserialize<cisco::common::MHDR>(
-      std::vector<std::byte>{bytes.cbegin() + packet_index, bytes.cend()}));
-  packet_index += field_size;
-  field_size = 4;
-  result.setMonitorID(cisco::common::deserialize<std::uint32_t>(
-      std::vector<std::byte>{bytes.cbegin() + packet_index, bytes.cend()}));
-  packet_index += field_size;
-  result.setPeripheralID(cisco::common::deserialize<std::uint32_t>(
-      std::vector<std::byte>{bytes.cbegin() + packet_index, bytes.cend()}));
-  packet_index += field_size;
-  result.setSessionID(cisco::common::deserialize<std::uint32_t>(
-      std::vector<std::byte>{bytes.cbegin() + packet_index, bytes.cend()}));
-  packet_index += field_size;
-  field_size = 2;
-  result.setPeripheralType(cisco::common::deserialize<std::uint16_t>(
-      std::vector<std::byte>{bytes.cbegin() + packet_index, bytes.cend()}));
-  packet_index += field_size;
-  result.setSkillGroupState(cisco::common::deserialize<std::uint16_t>(
-      std::vector<std::byte>{bytes.cbegin() + packet_index, bytes.cend()}));
-  packet_index += field_size;
-  field_size = 4;
-  result.setStateDuration(cisco::common::deserialize<std::uint32_t>(
-      std::vector<std::byte>{bytes.cbegin() + packet_index, bytes.cend()}));
-  packet_index += field_size;
-  result.setSkillGroupNumber(cisco::common::deserialize<std::uint32_t>(
-      std::vector<std::byte>{bytes.cbegin() + packet_index, bytes.cend()}));
-  packet_index += field_size;
-  result.setSkillGroupID(cisco::common::deserialize<std::uint32_t>(
-      std::vector<std::byte>{bytes.cbegin() + packet_index, bytes.cend()}));
-  packet_index += field_size;
-  field_size = 2;
-  result.setSkillGroupPriority(cisco::common::deserialize<std::uint16_t>(
-      std::vector<std::byte>{bytes.cbegin() + packet_index, bytes.cend()}));
-  packet_index += field_size;
-  field_size = 2;
-  result.setAgentState(cisco::common::deserialize<std::uint16_t>(
-      std::vector<std::byte>{bytes.cbegin() + packet_index, bytes.cend()}));
-  packet_index += field_size;
-  result.setEventReasonCode(cisco::common::deserialize<std::uint16_t>(
-      std::vector<std::byte>{bytes.cbegin() + packet_index, bytes.cend()}));
-  packet_index += field_size;
-  field_size = 4;
-  result.setMRDID(cisco::common::deserialize<std::int32_t>(
-      std::vector<std::byte>{bytes.cbegin() + packet_index, bytes.cend()}));
-  packet_index += field_size;
-  result.setNumTask(cisco::common::deserialize<std::uint32_t>(
-      std::vector<std::byte>{bytes.cbegin() + packet_index, bytes.cend()}));
-  packet_index += field_size;
-  field_size = 2;
-  result.setAgentMode(cisco::common::deserialize<std::uint16_t>(
-      std::vector<std::byte>{bytes.cbegin() + packet_index, bytes.cend()}));
-  packet_index += field_size;
-  field_size = 4;
-  result.setMaxTaskLimit(cisco::common::deserialize<std::uint32_t>(
-      std::vector<std::byte>{bytes.cbegin() + packet_index, bytes.cend()}));
-  packet_index += field_size;
-  result.setICMAgentID(cisco::common::deserialize<std::int32_t>(
-      std::vector<std::byte>{bytes.cbegin() + packet_index, bytes.cend()}));
-  packet_index += field_size;
-  result.setAgentAvailabilityStatus(cisco::common::deserialize<std::uint32_t>(
-      std::vector<std::byte>{bytes.cbegin() + packet_index, bytes.cend()}));
-  packet_index += field_size;
-  field_size = 2;
-  result.setNumFltSkillGroups(cisco::common::deserialize<std::uint16_t>(
-      std::vector<std::byte>{bytes.cbegin() + packet_index, bytes.cend()}));
-  packet_index += field_size;
-  field_size = 4;
-  result.setDepartmentID(cisco::common::deserialize<std::int32_t>(
-      std::vector<std::byte>{bytes.cbegin() + packet_index, bytes.cend()}));
-  packet_index += field_size;
-
-  // 가변 영역
-  while (packet_index < result.getMHDR().getMessageLength()) {
-    const cisco::common::FloatingData floating_data =
-        cisco::common::deserialize<cisco::common::FloatingData>(
-            std::vector<std::byte>{bytes.cbegin() + packet_index,
-                                   bytes.cend()});
-    packet_index += 4 + floating_data.getData().size();
-
-    switch (floating_data.getTag()) {
-    case cisco::common::TagValue::CTI_CLIENT_SIGNATURE_TAG: {
-      std::string cti_client_signature;
-      cti_client_signature.resize(floating_data.getData().size());
-      std::memcpy(cti_client_signature.data(), floating_data.getData().data(),
-                  floating_data.getData().size());
+  result.setMHDR(reader.read<cisco::common::MHDR>());
+  MessageLayout<message::AgentStateEvent>::decode(reader, result, mask.fixed);
 
-      result.setCTIClientSignature(cti_client_signature);
-    } break;
-    case cisco::common::TagValue::AGENT_ID_TAG: {
-      std::string agent_id;
-      agent_id.resize(floating_data.getData().size());
-      std::memcpy(agent_id.data(), floating_data.getData().data(),
-                  floating_data.getData().size());
-
-      result.setAgentID(agent_id);
-    } break;
-    case cisco::common::TagValue::AGENT_EXTENSION_TAG: {
-      std::string agent_extension;
-      agent_extension.resize(floating_data.getData().size());
-      std::memcpy(agent_extension.data(), floating_data.getData().data(),
-                  floating_data.getData().size());
-
-      result.setAgentExtension(agent_extension);
-    } break;
-    case cisco::common::TagValue::FLT_TERM_DEVICE_NAME: {
-      std::string active_terminal;
-      active_terminal.resize(floating_data.getData().size());
-      std::memcpy(active_terminal.data(), floating_data.getData().data(),
-                  floating_data.getData().size());
-
-      result.setActiveTerminal(active_terminal);
-    } break;
-    case cisco::common::TagValue::AGENT_INSTRUMENT_TAG: {
-      std::string agent_instrument;
-      agent_instrument.resize(floating_data.getData().size());
-      std::memcpy(agent_instrument.data(), floating_data.getData().data(),
-                  floating_data.getData().size());
-
-      result.setCTIClientSignature(agent_instrument);
-    } break;
-    case cisco::common::TagValue::DURATION_TAG: {
-      result.setDuration(
-          cisco::common::deserialize<std::uint32_t>(floating_data.getData()));
-    } break;
-    case cisco::common::TagValue::EXT_AGENT_STATE_TAG: {
-      result.setAgentState(
-          cisco::common::deserialize<std::uint16_t>(floating_data.getData()));
-    } break;
-    case cisco::common::TagValue::DIRECTION_TAG: {
-      result.setDirection(
-          cisco::common::deserialize<std::uint32_t>(floating_data.getData()));
-    } break;
-    case cisco::common::TagValue::SKILL_GROUP_NUMBER_TAG: {
-      result.setFltSkillGroupNumber(
-          cisco::common::deserialize<std::int32_t>(floating_data.getData()));
-    } break;
-    case cisco::common::TagValue::SKILL_GROUP_ID_TAG: {
-      result.setFltSkillGroupID(
-          cisco::common::deserialize<std::uint32_t>(floating_data.getData()));
-    } break;
-    case cisco::common::TagValue::SKILL_GROUP_PRIORITY_TAG: {
-      result.setFltSkillGroupPriority(
-          cisco::common::deserialize<std::uint16_t>(floating_data.getData()));
-    } break;
-    case cisco::common::TagValue::SKILL_GROUP_STATE_TAG: {
-      result.setFltSkillGroupState(
-          cisco::common::deserialize<std::uint16_t>(floating_data.getData()));
-    } break;
-    case cisco::common::TagValue::MAX_BEYOND_TASK_LIMIT_TAG: {
-      result.setMaxBeyondTaskLimit(
-          cisco::common::deserialize<std::uint32_t>(floating_data.getData()));
-    } break;
-    default:
-      break;
-    }
-  }
+  // 가변 영역 (MHDR 길이에는 MHDR 8바이트가 포함되지 않는다)
+  MessageFloatingLayout<message::AgentStateEvent>::decode(
+      reader, result.getMHDR().getMessageLength() + 8, result, mask.floating);
 
   return result;
 }
 
+template <>
+inline const cisco::message::AgentStateEvent
+cisco::common::deserialize(const std::span<const std::byte> bytes) {
+  return deserialize<cisco::message::AgentStateEvent>(bytes, DecodeMask::all());
+}
+
 #endif
\ No newline at end of file
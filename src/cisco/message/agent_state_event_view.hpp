@@ -0,0 +1,260 @@
+#pragma once
+
+#ifndef _CTM_CISCO_MESSAGE_AGENT_STATE_EVENT_VIEW_HPP_
+#define _CTM_CISCO_MESSAGE_AGENT_STATE_EVENT_VIEW_HPP_
+
+/*
+  AGENT_STATE_EVENT 패킷 뷰
+  +------+------------+---------------+
+  | MHDR | Fixed Part | Floating Part |
+  +------+------------+---------------+
+  고정 영역은 레이아웃 오프셋에서 필요할 때 읽고, 가변 영역은 생성 시 한 번만
+  훑어서 사용하는 태그의 위치만 기록한다. 원본 패킷보다 오래 살아있으면 안 된다.
+*/
+
+#include "../common/field_layout.hpp"
+#include "../common/mhdr.hpp"
+#include "../common/serializable.hpp"
+#include "../common/tag_value.hpp"
+#include "./agent_state_event.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+
+namespace cisco::message {
+class AgentStateEventView {
+public:
+  /**
+   * @brief Construct a new Agent State Event View object
+   *
+   * @param packet MHDR 부터 시작하는 패킷 (뒤따르는 다른 메시지는 무시한다)
+   */
+  explicit AgentStateEventView(const std::span<const std::byte> packet) {
+    const common::MHDR mhdr = common::deserialize<common::MHDR>(packet);
+    const std::size_t message_length =
+        common::field_size_v<common::MHDR> + mhdr.getMessageLength();
+    constexpr std::size_t fixed_length =
+        common::field_size_v<common::MHDR> +
+        common::MessageLayout<AgentStateEvent>::size;
+
+    // 이 메시지 영역만 남기고, 고정 영역 길이는 여기서 한 번만 검사한다
+    common::detail::requireLength(packet, message_length);
+    common::detail::requireLength(packet, fixed_length);
+    this->packet = packet.first(message_length);
+
+    common::ByteReader floating_reader{this->packet};
+    floating_reader.skip(fixed_length);
+
+    // 가변 영역 색인
+    while (floating_reader.getRemaining() > 0) {
+      const common::TagValue tag = floating_reader.read<common::TagValue>();
+      const std::uint16_t length = floating_reader.read<std::uint16_t>();
+      const std::size_t offset = floating_reader.getPosition();
+      floating_reader.skip(length);
+
+      FloatingSlot *slot = findSlot(tag);
+      if (slot != nullptr) {
+        slot->offset = static_cast<std::uint32_t>(offset);
+        slot->length = length;
+        slot->present = true;
+      }
+    }
+  }
+
+  /**
+   * @brief Destroy the Agent State Event View object
+   *
+   */
+  ~AgentStateEventView() = default;
+
+  std::uint32_t getMonitorID() const {
+    return fixed<&AgentStateEvent::getMonitorID>();
+  }
+  std::uint32_t getPeripheralID() const {
+    return fixed<&AgentStateEvent::getPeripheralID>();
+  }
+  std::uint32_t getSessionID() const {
+    return fixed<&AgentStateEvent::getSessionID>();
+  }
+  std::uint32_t getStateDuration() const {
+    return fixed<&AgentStateEvent::getStateDuration>();
+  }
+  std::uint32_t getSkillGroupNumber() const {
+    return fixed<&AgentStateEvent::getSkillGroupNumber>();
+  }
+  std::uint32_t getSkillGroupID() const {
+    return fixed<&AgentStateEvent::getSkillGroupID>();
+  }
+  std::uint16_t getEventReasonCode() const {
+    return fixed<&AgentStateEvent::getEventReasonCode>();
+  }
+  std::int32_t getMRDID() const { return fixed<&AgentStateEvent::getMRDID>(); }
+  std::int32_t getICMAgentID() const {
+    return fixed<&AgentStateEvent::getICMAgentID>();
+  }
+  std::int32_t getDepartmentID() const {
+    return fixed<&AgentStateEvent::getDepartmentID>();
+  }
+  /**
+   * @brief Get the Agent State object (EXT_AGENT_STATE 가 있으면 우선한다)
+   *
+   * @return std::uint16_t
+   */
+  std::uint16_t getAgentState() const {
+    return ext_agent_state.present
+               ? floating<std::uint16_t>(ext_agent_state)
+               : fixed<&AgentStateEvent::getAgentState>();
+  }
+  /**
+   * @brief Get the CTI Client Signature object
+   *
+   * @return std::string_view
+   */
+  std::string_view getCTIClientSignature() const {
+    return text(cti_client_signature);
+  }
+  /**
+   * @brief Get the Agent ID object
+   *
+   * @return std::string_view
+   */
+  std::string_view getAgentID() const { return text(agent_id); }
+  /**
+   * @brief Get the Agent Extension object
+   *
+   * @return std::string_view
+   */
+  std::string_view getAgentExtension() const { return text(agent_extension); }
+  /**
+   * @brief Get the Agent Instrument object
+   *
+   * @return std::string_view
+   */
+  std::string_view getAgentInstrument() const {
+    return text(agent_instrument);
+  }
+  /**
+   * @brief Get the Duration object
+   *
+   * @return std::uint32_t
+   */
+  std::uint32_t getDuration() const {
+    return floating<std::uint32_t>(duration);
+  }
+  /**
+   * @brief Get the Direction object
+   *
+   * @return std::uint32_t
+   */
+  std::uint32_t getDirection() const {
+    return floating<std::uint32_t>(direction);
+  }
+
+protected:
+private:
+  /**
+   * @brief 가변 필드 위치
+   *
+   */
+  struct FloatingSlot {
+    std::uint32_t offset = 0;
+    std::uint16_t length = 0;
+    bool present = false;
+  };
+
+  /**
+   * @brief 고정 영역 필드를 레이아웃 오프셋에서 읽는다
+   *
+   * @tparam Getter
+   * @return 필드 타입
+   */
+  template <auto Getter>
+  typename common::detail::GetterTraits<decltype(Getter)>::value_type
+  fixed() const {
+    using T =
+        typename common::detail::GetterTraits<decltype(Getter)>::value_type;
+    constexpr std::size_t offset =
+        common::field_size_v<common::MHDR> +
+        common::MessageLayout<AgentStateEvent>::offsetOf<Getter>();
+
+    return common::detail::load<T>(packet.data() + offset);
+  }
+
+  /**
+   * @brief 고정 길이 가변 필드를 읽는다 (없으면 0)
+   *
+   * @tparam T
+   * @param slot
+   * @return T
+   */
+  template <typename T> T floating(const FloatingSlot &slot) const {
+    if (!slot.present) {
+      return 0;
+    }
+
+    return common::deserialize<T>(packet.subspan(slot.offset, slot.length));
+  }
+
+  /**
+   * @brief 문자열 가변 필드를 읽는다 (없으면 빈 문자열)
+   *
+   * @param slot
+   * @return std::string_view
+   */
+  std::string_view text(const FloatingSlot &slot) const {
+    if (!slot.present) {
+      return std::string_view{};
+    }
+
+    std::string_view result{
+        reinterpret_cast<const char *>(packet.data() + slot.offset),
+        slot.length};
+
+    // 널 문자로 끝나는 필드는 널 문자 앞까지만 사용한다
+    const std::size_t terminator = result.find('\0');
+
+    return terminator == std::string_view::npos ? result
+                                                : result.substr(0, terminator);
+  }
+
+  /**
+   * @brief 색인 대상 태그의 슬롯을 찾는다
+   *
+   * @param tag
+   * @return FloatingSlot*
+   */
+  FloatingSlot *findSlot(const common::TagValue tag) {
+    switch (tag) {
+    case common::TagValue::CTI_CLIENT_SIGNATURE_TAG:
+      return &cti_client_signature;
+    case common::TagValue::AGENT_ID_TAG:
+      return &agent_id;
+    case common::TagValue::AGENT_EXTENSION_TAG:
+      return &agent_extension;
+    case common::TagValue::AGENT_INSTRUMENT_TAG:
+      return &agent_instrument;
+    case common::TagValue::DURATION_TAG:
+      return &duration;
+    case common::TagValue::EXT_AGENT_STATE_TAG:
+      return &ext_agent_state;
+    case common::TagValue::DIRECTION_TAG:
+      return &direction;
+    default:
+      return nullptr;
+    }
+  }
+
+  std::span<const std::byte> packet;
+  FloatingSlot cti_client_signature;
+  FloatingSlot agent_id;
+  FloatingSlot agent_extension;
+  FloatingSlot agent_instrument;
+  FloatingSlot duration;
+  FloatingSlot ext_agent_state;
+  FloatingSlot direction;
+};
+} // namespace cisco::message
+
+#endif
@@ -3,13 +3,16 @@
 #ifndef _CTM_CISCO_MISCELLANEOUS_SYSTEM_EVENT_HPP_
 #define _CTM_CISCO_MISCELLANEOUS_SYSTEM_EVENT_HPP_
 
+#include "../common/field_layout.hpp"
 #include "../common/floating_data.hpp"
+#include "../common/floating_layout.hpp"
 #include "../common/mhdr.hpp"
 #include "../common/time.hpp"
 
 #include <cstdint>
 #include <cstring>
 #include <optional>
+#include <span>
 #include <string_view>
 #include <vector>
 
@@ -145,7 +148,7 @@ public:
    * @param system_event_arg_2
    */
   void setSystemEventArg2(const std::uint32_t system_event_arg_2) {
-    this->system_event_arg_1 = system_event_arg_2;
+    this->system_event_arg_2 = system_event_arg_2;
   }
   /**
    * @brief Set the System Event Arg3 object
@@ -168,111 +171,90 @@ public:
    *
    * @param text
    */
-  void setText(const std::string_view &text) { this->text = text.data(); }
+  void setText(const std::string_view &text) { this->text = text; }
   /**
    * @brief Set the Event Device ID object
    *
    * @param event_device_id
    */
   void setEventDeviceID(const std::string_view &event_device_id) {
-    this->event_device_id = event_device_id.data();
+    this->event_device_id = event_device_id;
   }
 
 protected:
 private:
   // 고정 데이터 영역
-  common::MHDR mhdr;
-  std::uint32_t pg_status;
-  common::Time icm_central_controller_time;
-  std::uint32_t system_event_id;
-  std::uint32_t system_event_arg_1;
-  std::uint32_t system_event_arg_2;
-  std::uint32_t system_event_arg_3;
-  std::uint16_t event_device_type;
+  common::MHDR mhdr{};
+  std::uint32_t pg_status{};
+  common::Time icm_central_controller_time{};
+  std::uint32_t system_event_id{};
+  std::uint32_t system_event_arg_1{};
+  std::uint32_t system_event_arg_2{};
+  std::uint32_t system_event_arg_3{};
+  std::uint16_t event_device_type{};
   // 가변 데이터 영역
   std::optional<std::string> text;
   std::optional<std::string> event_device_id;
 };
 } // namespace cisco::misc
 
+namespace cisco::common {
+/**
+ * @brief SYSTEM_EVENT 고정 영역 레이아웃
+ *
+ */
 template <>
-inline const cisco::misc::SystemEvent
-cisco::common::deserialize(const std::vector<std::byte> &bytes) {
-  cisco::misc::SystemEvent system_event{};
-
-  size_t packet_index = 0;
-  size_t field_size = 8;
-
-  system_event.setMHDR(deserialize<cisco::common::MHDR>(
-      std::vector<std::byte>{bytes.cbegin() + packet_index,
-                             bytes.cbegin() + packet_index + field_size}));
-  packet_index += field_size;
-
-  field_size = 4;
-  system_event.setPGStatus(deserialize<std::uint32_t>(
-      std::vector<std::byte>{bytes.cbegin() + packet_index,
-                             bytes.cbegin() + packet_index + field_size}));
-  packet_index += field_size;
-
-  system_event.setICMCentralControllerTime(deserialize<cisco::common::Time>(
-      std::vector<std::byte>{bytes.cbegin() + packet_index,
-                             bytes.cbegin() + packet_index + field_size}));
-  packet_index += field_size;
-
-  system_event.setSystemEventID(deserialize<std::uint32_t>(
-      std::vector<std::byte>{bytes.cbegin() + packet_index,
-                             bytes.cbegin() + packet_index + field_size}));
-  packet_index += field_size;
-
-  system_event.setSystemEventArg1(deserialize<std::uint32_t>(
-      std::vector<std::byte>{bytes.cbegin() + packet_index,
-                             bytes.cbegin() + packet_index + field_size}));
-  packet_index += field_size;
-
-  system_event.setSystemEventArg2(deserialize<std::uint32_t>(
-      std::vector<std::byte>{bytes.cbegin() + packet_index,
-                             bytes.cbegin() + packet_index + field_size}));
-  packet_index += field_size;
-
-  system_event.setSystemEventArg3(deserialize<std::uint32_t>(
-      std::vector<std::byte>{bytes.cbegin() + packet_index,
-                             bytes.cbegin() + packet_index + field_size}));
-  packet_index += field_size;
+struct MessageLayout<misc::SystemEvent>
+    : FieldLayout<
+          Field<&misc::SystemEvent::getPGStatus,
+                &misc::SystemEvent::setPGStatus>,
+          Field<&misc::SystemEvent::getICMCentralControllerTime,
+                &misc::SystemEvent::setICMCentralControllerTime>,
+          Field<&misc::SystemEvent::getSystemEventID,
+                &misc::SystemEvent::setSystemEventID>,
+          Field<&misc::SystemEvent::getSystemEventArg1,
+                &misc::SystemEvent::setSystemEventArg1>,
+          Field<&misc::SystemEvent::getSystemEventArg2,
+                &misc::SystemEvent::setSystemEventArg2>,
+          Field<&misc::SystemEvent::getSystemEventArg3,
+                &misc::SystemEvent::setSystemEventArg3>,
+          Field<&misc::SystemEvent::getEventDeviceType,
+                &misc::SystemEvent::setEventDeviceType>> {};
 
-  field_size = 2;
-  system_event.setEventDeviceType(deserialize<std::uint16_t>(
-      std::vector<std::byte>{bytes.cbegin() + packet_index,
-                             bytes.cbegin() + packet_index + field_size}));
-  packet_index += field_size;
+/**
+ * @brief SYSTEM_EVENT 가변 영역 레이아웃
+ *
+ */
+template <>
+struct MessageFloatingLayout<misc::SystemEvent>
+    : FloatingLayout<misc::SystemEvent,
+                     FloatingField<TagValue::TEXT_TAG,
+                                   &misc::SystemEvent::setText>,
+                     FloatingField<TagValue::EVENT_DEVICE_ID_TAG,
+                                   &misc::SystemEvent::setEventDeviceID>> {};
+} // namespace cisco::common
 
-  while (packet_index < system_event.getMHDR().getMessageLength() + 8) {
-    cisco::common::FloatingData floating_data =
-        deserialize<cisco::common::FloatingData>(std::vector<std::byte>{
-            bytes.cbegin() + packet_index, bytes.cend()});
+template <>
+inline const cisco::misc::SystemEvent
+cisco::common::deserialize(const std::span<const std::byte> bytes,
+                           const DecodeMask mask) {
+  cisco::misc::SystemEvent system_event{};
+  ByteReader reader{bytes};
 
-    packet_index += floating_data.getData().size() + 4;
+  system_event.setMHDR(reader.read<cisco::common::MHDR>());
+  MessageLayout<misc::SystemEvent>::decode(reader, system_event, mask.fixed);
 
-    switch (floating_data.getTag()) {
-    case TagValue::TEXT_TAG: {
-      std::string text;
-      text.resize(floating_data.getData().size());
-      std::memcpy(text.data(), floating_data.getData().data(),
-                  floating_data.getData().size());
-      system_event.setText(text);
-    } break;
-    case TagValue::EVENT_DEVICE_ID_TAG: {
-      std::string event_device_id;
-      event_device_id.resize(floating_data.getData().size());
-      std::memcpy(event_device_id.data(), floating_data.getData().data(),
-                  floating_data.getData().size());
-      system_event.setEventDeviceID(event_device_id);
-    } break;
-    default:
-      break;
-    }
-  }
+  MessageFloatingLayout<misc::SystemEvent>::decode(
+      reader, system_event.getMHDR().getMessageLength() + 8, system_event,
+      mask.floating);
 
   return system_event;
 }
 
+template <>
+inline const cisco::misc::SystemEvent
+cisco::common::deserialize(const std::span<const std::byte> bytes) {
+  return deserialize<cisco::misc::SystemEvent>(bytes, DecodeMask::all());
+}
+
 #endif
\ No newline at end of file
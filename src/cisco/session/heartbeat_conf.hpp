@@ -10,10 +10,13 @@
   +------+------------+
 */
 
+#include "../common/field_layout.hpp"
 #include "../common/mhdr.hpp"
 #include "../common/serializable.hpp"
 
+#include <cstddef>
 #include <cstdint>
+#include <span>
 
 namespace cisco::session {
 class HeartbeatConf {
@@ -67,16 +70,26 @@ private:
 };
 } // namespace cisco::session
 
+namespace cisco::common {
+/**
+ * @brief HEARTBEAT_CONF 고정 영역 레이아웃
+ *
+ */
 template <>
-inline const cisco::session::HeartbeatConf
-cisco::common::deserialize(const std::vector<std::byte> &bytes) {
+struct MessageLayout<session::HeartbeatConf>
+    : FieldLayout<
+          Field<&session::HeartbeatConf::getInvokeID,
+                &session::HeartbeatConf::setInvokeID>> {};
+} // namespace cisco::common
 
+template <>
+inline const cisco::session::HeartbeatConf
+cisco::common::deserialize(const std::span<const std::byte> bytes) {
   cisco::session::HeartbeatConf result{};
+  ByteReader reader{bytes};
 
-  result.setMHDR(deserialize<cisco::common::MHDR>(
-      std::vector<std::byte>{bytes.cbegin(), bytes.cbegin() + 8}));
-  result.setInvokeID(deserialize<std::uint32_t>(
-      std::vector<std::byte>{bytes.cbegin() + 8, bytes.cend()}));
+  result.setMHDR(reader.read<cisco::common::MHDR>());
+  MessageLayout<session::HeartbeatConf>::decode(reader, result);
 
   return result;
 }
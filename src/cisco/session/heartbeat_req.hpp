@@ -10,6 +10,7 @@
   +------+------------+
 */
 
+#include "../common/field_layout.hpp"
 #include "../common/mhdr.hpp"
 #include "../common/serializable.hpp"
 
@@ -65,22 +66,32 @@ class HeartbeatReq {
   protected:
   private:
     common::MHDR mhdr;
-    std::uint32_t invoke_id;
+    std::uint32_t invoke_id{0};
 };
 } // namespace cisco::session
 
+namespace cisco::common {
+/**
+ * @brief HEARTBEAT_REQ 고정 영역 레이아웃
+ *
+ */
+template <>
+struct MessageLayout<session::HeartbeatReq>
+    : FieldLayout<
+          Field<&session::HeartbeatReq::getInvokeID,
+                &session::HeartbeatReq::setInvokeID>> {};
+} // namespace cisco::common
+
 template <>
 inline const std::vector<std::byte>
 cisco::common::serialize(const cisco::session::HeartbeatReq &heartbeat_req) {
-    std::vector<std::byte> result{};
-
-    const auto mhdr = serialize(heartbeat_req.getMHDR());
-    const auto invoke_id = serialize(heartbeat_req.getInvokeID());
+    ByteWriter writer{field_size_v<MHDR> +
+                      MessageLayout<session::HeartbeatReq>::size};
 
-    std::move(mhdr.cbegin(), mhdr.cend(), std::back_inserter(result));
-    std::move(invoke_id.cbegin(), invoke_id.cend(), std::back_inserter(result));
+    writer.write(heartbeat_req.getMHDR());
+    MessageLayout<session::HeartbeatReq>::encode(writer, heartbeat_req);
 
-    return result;
+    return writer.release();
 }
 
 #endif
\ No newline at end of file
@@ -3,7 +3,9 @@
 #ifndef _CTM_CISCO_SESSION_OPEN_CONF_HPP_
 #define _CTM_CISCO_SESSION_OPEN_CONF_HPP_
 
+#include "../common/field_layout.hpp"
 #include "../common/floating_data.hpp"
+#include "../common/floating_layout.hpp"
 #include "../common/mhdr.hpp"
 #include "../common/time.hpp"
 
@@ -11,6 +13,7 @@
 #include <cstdint>
 #include <cstring>
 #include <optional>
+#include <span>
 #include <string_view>
 #include <vector>
 
@@ -83,13 +86,13 @@ public:
     this->session_type = session_type;
   }
   void setAgentExtension(const std::string_view &agent_extension) {
-    this->agent_extension = agent_extension.data();
+    this->agent_extension = agent_extension;
   }
   void setAgentID(const std::string_view &agent_id) {
-    this->agent_id = agent_id.data();
+    this->agent_id = agent_id;
   }
   void setAgentInstrument(const std::string_view &agent_instrument) {
-    this->agent_instrument = agent_instrument.data();
+    this->agent_instrument = agent_instrument;
   }
   void setNumPeripherals(const std::uint16_t num_peripherals) {
     this->num_peripherals = num_peripherals;
@@ -104,17 +107,17 @@ public:
 protected:
 private:
   // 고정 데이터 영역
-  cisco::common::MHDR mhdr;
-  std::uint32_t invoke_id;
-  std::uint32_t service_granted;
-  std::uint32_t monitor_id;
-  std::uint32_t pg_status;
-  cisco::common::Time icm_central_controller_time;
-  bool peripheral_online;
-  std::uint16_t peripheral_type;
-  std::uint16_t agent_state;
-  std::int32_t department_id;
-  std::uint16_t session_type;
+  cisco::common::MHDR mhdr{};
+  std::uint32_t invoke_id{};
+  std::uint32_t service_granted{};
+  std::uint32_t monitor_id{};
+  std::uint32_t pg_status{};
+  cisco::common::Time icm_central_controller_time{};
+  bool peripheral_online{};
+  std::uint16_t peripheral_type{};
+  std::uint16_t agent_state{};
+  std::int32_t department_id{};
+  std::uint16_t session_type{};
   // 가변 데이터 영역
   std::optional<std::string> agent_extension;
   std::optional<std::string> agent_id;
@@ -125,125 +128,77 @@ private:
 };
 } // namespace cisco::session
 
+namespace cisco::common {
+/**
+ * @brief OPEN_CONF 고정 영역 레이아웃
+ *
+ */
+template <>
+struct MessageLayout<session::OpenConf>
+    : FieldLayout<
+          Field<&session::OpenConf::getInvokeID,
+                &session::OpenConf::setInvokeID>,
+          Field<&session::OpenConf::getServiceGranted,
+                &session::OpenConf::setServiceGranted>,
+          Field<&session::OpenConf::getMonitorID,
+                &session::OpenConf::setMonitorID>,
+          Field<&session::OpenConf::getPGStatus,
+                &session::OpenConf::setPGStatus>,
+          Field<&session::OpenConf::getICMCentralControllerTime,
+                &session::OpenConf::setICMCentralControllerTime>,
+          Field<&session::OpenConf::getPeripheralOnline,
+                &session::OpenConf::setPeripheralOnline>,
+          Field<&session::OpenConf::getPeripheralType,
+                &session::OpenConf::setPeripheralType>,
+          Field<&session::OpenConf::getAgentState,
+                &session::OpenConf::setAgentState>,
+          Field<&session::OpenConf::getDepartmentID,
+                &session::OpenConf::setDepartmentID>,
+          Field<&session::OpenConf::getSessionType,
+                &session::OpenConf::setSessionType>> {};
+
+/**
+ * @brief OPEN_CONF 가변 영역 레이아웃
+ *
+ * flt_peripheral_id 태그는 문서상 정의되지 않음...
+ */
+template <>
+struct MessageFloatingLayout<session::OpenConf>
+    : FloatingLayout<
+          session::OpenConf,
+          FloatingField<TagValue::AGENT_EXTENSION_TAG,
+                        &session::OpenConf::setAgentExtension>,
+          FloatingField<TagValue::AGENT_ID_TAG,
+                        &session::OpenConf::setAgentID>,
+          FloatingField<TagValue::AGENT_INSTRUMENT_TAG,
+                        &session::OpenConf::setAgentInstrument>,
+          FloatingField<TagValue::NUM_PERIPHERALS_TAG,
+                        &session::OpenConf::setNumPeripherals>,
+          FloatingField<TagValue::MULTI_LINE_AGENT_CONTROL_TAG,
+                        &session::OpenConf::setMultilineAgentControl>> {};
+} // namespace cisco::common
+
 template <>
 inline const cisco::session::OpenConf
-cisco::common::deserialize(const std::vector<std::byte> &bytes) {
+cisco::common::deserialize(const std::span<const std::byte> bytes,
+                           const DecodeMask mask) {
   cisco::session::OpenConf open_conf{};
+  ByteReader reader{bytes};
 
-  size_t packet_index = 0;
-  size_t field_length = 8;
-
-  open_conf.setMHDR(deserialize<cisco::common::MHDR>(
-      std::vector<std::byte>{bytes.cbegin() + packet_index,
-                             bytes.cbegin() + packet_index + field_length}));
-  packet_index += field_length;
-
-  field_length = 4;
-  open_conf.setInvokeID(deserialize<std::uint32_t>(
-      std::vector<std::byte>{bytes.cbegin() + packet_index,
-                             bytes.cbegin() + packet_index + field_length}));
-  packet_index += field_length;
-
-  field_length = 4;
-  open_conf.setServiceGranted(deserialize<std::uint32_t>(
-      std::vector<std::byte>{bytes.cbegin() + packet_index,
-                             bytes.cbegin() + packet_index + field_length}));
-  packet_index += field_length;
-
-  field_length = 4;
-  open_conf.setMonitorID(deserialize<std::uint32_t>(
-      std::vector<std::byte>{bytes.cbegin() + packet_index,
-                             bytes.cbegin() + packet_index + field_length}));
-  packet_index += field_length;
-
-  field_length = 4;
-  open_conf.setPGStatus(deserialize<std::uint32_t>(
-      std::vector<std::byte>{bytes.cbegin() + packet_index,
-                             bytes.cbegin() + packet_index + field_length}));
-  packet_index += field_length;
-
-  field_length = 4;
-  open_conf.setICMCentralControllerTime(deserialize<cisco::common::Time>(
-      std::vector<std::byte>{bytes.cbegin() + packet_index,
-                             bytes.cbegin() + packet_index + field_length}));
-  packet_index += field_length;
-
-  field_length = 2;
-  open_conf.setPeripheralOnline(deserialize<bool>(
-      std::vector<std::byte>{bytes.cbegin() + packet_index,
-                             bytes.cbegin() + packet_index + field_length}));
-  packet_index += field_length;
-
-  field_length = 2;
-  open_conf.setPeripheralType(deserialize<std::uint16_t>(
-      std::vector<std::byte>{bytes.cbegin() + packet_index,
-                             bytes.cbegin() + packet_index + field_length}));
-  packet_index += field_length;
-
-  field_length = 2;
-  open_conf.setAgentState(deserialize<std::uint16_t>(
-      std::vector<std::byte>{bytes.cbegin() + packet_index,
-                             bytes.cbegin() + packet_index + field_length}));
-  packet_index += field_length;
+  open_conf.setMHDR(reader.read<cisco::common::MHDR>());
+  MessageLayout<session::OpenConf>::decode(reader, open_conf, mask.fixed);
 
-  field_length = 4;
-  open_conf.setDepartmentID(deserialize<std::int32_t>(
-      std::vector<std::byte>{bytes.cbegin() + packet_index,
-                             bytes.cbegin() + packet_index + field_length}));
-  packet_index += field_length;
-
-  field_length = 2;
-  open_conf.setSessionType(deserialize<std::uint16_t>(
-      std::vector<std::byte>{bytes.cbegin() + packet_index,
-                             bytes.cbegin() + packet_index + field_length}));
-  packet_index += field_length;
-
-  while (packet_index < open_conf.getMHDR().getMessageLength() + 8) {
-    const cisco::common::FloatingData floating_data =
-        deserialize<cisco::common::FloatingData>(std::vector<std::byte>{
-            bytes.cbegin() + packet_index, bytes.cend()});
-    packet_index += 4 + floating_data.getData().size();
-
-    switch (floating_data.getTag()) {
-    case TagValue::AGENT_EXTENSION_TAG: {
-      std::string agent_extension{};
-      agent_extension.resize(floating_data.getData().size());
-      std::memcpy(agent_extension.data(), floating_data.getData().data(),
-                  floating_data.getData().size());
-
-      open_conf.setAgentExtension(agent_extension);
-    } break;
-    case TagValue::AGENT_ID_TAG: {
-      std::string agent_id{};
-      agent_id.resize(floating_data.getData().size());
-      std::memcpy(agent_id.data(), floating_data.getData().data(),
-                  floating_data.getData().size());
-
-      open_conf.setAgentID(agent_id);
-    } break;
-    case TagValue::AGENT_INSTRUMENT_TAG: {
-      std::string agent_instrument{};
-      agent_instrument.resize(floating_data.getData().size());
-      std::memcpy(agent_instrument.data(), floating_data.getData().data(),
-                  floating_data.getData().size());
-
-      open_conf.setAgentInstrument(agent_instrument);
-    } break;
-    case TagValue::NUM_PERIPHERALS_TAG: {
-      open_conf.setNumPeripherals(
-          deserialize<std::uint16_t>(floating_data.getData()));
-    } break;
-    case TagValue::MULTI_LINE_AGENT_CONTROL_TAG: {
-      open_conf.setMultilineAgentControl(
-          deserialize<std::uint16_t>(floating_data.getData()));
-    } break;
-      // flt_peripheral_id 태그는 문서상 정의되지 않음...
-    default:
-      break;
-    }
-  }
+  MessageFloatingLayout<session::OpenConf>::decode(
+      reader, open_conf.getMHDR().getMessageLength() + 8, open_conf,
+      mask.floating);
 
   return open_conf;
 }
 
+template <>
+inline const cisco::session::OpenConf
+cisco::common::deserialize(const std::span<const std::byte> bytes) {
+  return deserialize<cisco::session::OpenConf>(bytes, DecodeMask::all());
+}
+
 #endif
\ No newline at end of file
@@ -10,6 +10,7 @@
   +------+------------+---------------+
 */
 
+#include "../common/field_layout.hpp"
 #include "../common/floating_data.hpp"
 #include "../common/mhdr.hpp"
 #include "../common/serializable.hpp"
@@ -123,61 +124,61 @@ class OpenReq {
     /**
      * @brief Get the Client ID object
      *
-     * @return const common::FloatingData
+     * @return const common::FloatingData&
      */
-    const common::FloatingData getClientID() const { return client_id; }
+    const common::FloatingData &getClientID() const { return client_id; }
     /**
      * @brief Get the Client PW object
      *
-     * @return const common::FloatingData
+     * @return const common::FloatingData&
      */
-    const common::FloatingData getClientPW() const { return client_pw; }
+    const common::FloatingData &getClientPW() const { return client_pw; }
     /**
      * @brief Get the Client Signature object
      *
-     * @return const std::optional<common::FloatingData>
+     * @return const std::optional<common::FloatingData>&
      */
-    const std::optional<common::FloatingData> getClientSignature() const {
+    const std::optional<common::FloatingData> &getClientSignature() const {
         return client_signature;
     }
     /**
      * @brief Get the Agent Extension object
      *
-     * @return const std::optional<common::FloatingData>
+     * @return const std::optional<common::FloatingData>&
      */
-    const std::optional<common::FloatingData> getAgentExtension() const {
+    const std::optional<common::FloatingData> &getAgentExtension() const {
         return agent_extension;
     }
     /**
      * @brief Get the Agent ID object
      *
-     * @return const std::optional<common::FloatingData>
+     * @return const std::optional<common::FloatingData>&
      */
-    const std::optional<common::FloatingData> getAgentID() const {
+    const std::optional<common::FloatingData> &getAgentID() const {
         return agent_id;
     }
     /**
      * @brief Get the Agent Instrument object
      *
-     * @return const std::optional<common::FloatingData>
+     * @return const std::optional<common::FloatingData>&
      */
-    const std::optional<common::FloatingData> getAgentInstrument() const {
+    const std::optional<common::FloatingData> &getAgentInstrument() const {
         return agent_instrument;
     }
     /**
      * @brief Get the Application Path ID object
      *
-     * @return const std::optional<common::FloatingData>
+     * @return const std::optional<common::FloatingData>&
      */
-    const std::optional<common::FloatingData> getApplicationPathID() const {
+    const std::optional<common::FloatingData> &getApplicationPathID() const {
         return application_path_id;
     }
     /**
      * @brief Get the Unique Instance ID object
      *
-     * @return const std::optional<common::FloatingData>
+     * @return const std::optional<common::FloatingData>&
      */
-    const std::optional<common::FloatingData> getUniqueInstanceID() const {
+    const std::optional<common::FloatingData> &getUniqueInstanceID() const {
         return unique_instance_id;
     }
 
@@ -363,38 +364,83 @@ class OpenReq {
 };
 } // namespace cisco::session
 
+namespace cisco::common {
+/**
+ * @brief OPEN_REQ 고정 영역 레이아웃
+ *
+ */
+template <>
+struct MessageLayout<session::OpenReq>
+    : FieldLayout<
+          Field<&session::OpenReq::getInvokeID,
+                &session::OpenReq::setInvokeID>,
+          Field<&session::OpenReq::getVersionNumber,
+                &session::OpenReq::setVersionNumber>,
+          Field<&session::OpenReq::getIdleTimeout,
+                &session::OpenReq::setIdleTimeout>,
+          Field<&session::OpenReq::getPeripheralID,
+                &session::OpenReq::setPeripheralID>,
+          Field<&session::OpenReq::getServicesRequested,
+                &session::OpenReq::setServicesRequested>,
+          Field<&session::OpenReq::getCallMessageMask,
+                &session::OpenReq::setCallMessageMask>,
+          Field<&session::OpenReq::getAgentStateMask,
+                &session::OpenReq::setAgentStateMask>,
+          Field<&session::OpenReq::getConfigMessageMask,
+                &session::OpenReq::setConfigMessageMask>,
+          Field<&session::OpenReq::getReserved1,
+                &session::OpenReq::setReserved1>,
+          Field<&session::OpenReq::getReserved2,
+                &session::OpenReq::setReserved2>,
+          Field<&session::OpenReq::getReserved3,
+                &session::OpenReq::setReserved3>> {};
+} // namespace cisco::common
+
 template <>
 inline const std::vector<std::byte>
 cisco::common::serialize(const cisco::session::OpenReq &open_req) {
-    std::vector<std::byte> result{};
+    const auto floating_size =
+        [](const std::optional<FloatingData> &floating_data) -> std::size_t {
+        return floating_data.has_value()
+                   ? 4 + floating_data->getData().size()
+                   : 0;
+    };
+    const auto write_floating =
+        [](ByteWriter &writer,
+           const std::optional<FloatingData> &floating_data) {
+            if (floating_data.has_value()) {
+                writer.write(floating_data.value());
+            }
+        };
 
-    std::vector<std::vector<std::byte>> members{};
-    members.emplace_back(serialize(open_req.getMHDR()));
-    members.emplace_back(serialize(open_req.getInvokeID()));
-    members.emplace_back(serialize(open_req.getVersionNumber()));
-    members.emplace_back(serialize(open_req.getIdleTimeout()));
-    members.emplace_back(serialize(open_req.getPeripheralID()));
-    members.emplace_back(serialize(open_req.getServicesRequested()));
-    members.emplace_back(serialize(open_req.getCallMessageMask()));
-    members.emplace_back(serialize(open_req.getAgentStateMask()));
-    members.emplace_back(serialize(open_req.getConfigMessageMask()));
-    members.emplace_back(serialize(open_req.getReserved1()));
-    members.emplace_back(serialize(open_req.getReserved2()));
-    members.emplace_back(serialize(open_req.getReserved3()));
-    members.emplace_back(serialize(open_req.getClientID()));
-    members.emplace_back(serialize(open_req.getClientPW()));
-    members.emplace_back(serialize(open_req.getClientSignature()));
-    members.emplace_back(serialize(open_req.getAgentExtension()));
-    members.emplace_back(serialize(open_req.getAgentID()));
-    members.emplace_back(serialize(open_req.getAgentInstrument()));
-    members.emplace_back(serialize(open_req.getApplicationPathID()));
-    members.emplace_back(serialize(open_req.getUniqueInstanceID()));
+    // 패킷 전체 길이를 미리 계산해 버퍼를 한 번만 할당한다
+    const std::size_t length =
+        field_size_v<MHDR> + MessageLayout<session::OpenReq>::size + 4 +
+        open_req.getClientID().getData().size() + 4 +
+        open_req.getClientPW().getData().size() +
+        floating_size(open_req.getClientSignature()) +
+        floating_size(open_req.getAgentExtension()) +
+        floating_size(open_req.getAgentID()) +
+        floating_size(open_req.getAgentInstrument()) +
+        floating_size(open_req.getApplicationPathID()) +
+        floating_size(open_req.getUniqueInstanceID());
 
-    for (const auto &member : members) {
-        std::move(member.cbegin(), member.cend(), std::back_inserter(result));
-    }
+    ByteWriter writer{length};
+    writer.write(open_req.getMHDR());
+    MessageLayout<session::OpenReq>::encode(writer, open_req);
+    writer.write(open_req.getClientID());
+    writer.write(open_req.getClientPW());
+    write_floating(writer, open_req.getClientSignature());
+    write_floating(writer, open_req.getAgentExtension());
+    write_floating(writer, open_req.getAgentID());
+    write_floating(writer, open_req.getAgentInstrument());
+    write_floating(writer, open_req.getApplicationPathID());
+    write_floating(writer, open_req.getUniqueInstanceID());
+
+    // 선택 필드까지 포함한 실제 본문 길이로 MHDR 을 갱신한다
+    patchMessageLength(writer);
 
-    return result;
+    return writer.release();
 }
 
 #endif
@@ -3,22 +3,56 @@
 #ifndef _CTM_CISCO_SUPERVISOR_AGENT_TEAM_CONFIG_EVENT_HPP_
 #define _CTM_CISCO_SUPERVISOR_AGENT_TEAM_CONFIG_EVENT_HPP_
 
+#include "../common/decode_resource.hpp"
+#include "../common/field_layout.hpp"
+#include "../common/fixed_string.hpp"
 #include "../common/floating_data.hpp"
+#include "../common/floating_layout.hpp"
 #include "../common/mhdr.hpp"
 
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
-#include <optional>
+#include <memory_resource>
+#include <span>
+#include <string>
 #include <string_view>
+#include <utility>
 #include <vector>
 
 namespace cisco::supervisor {
-struct ATCAgent {
-  std::string atc_agent_id;
-  std::uint16_t agent_flag;
-  std::uint16_t atc_agent_state;
-  std::uint16_t atc_agent_state_duration;
+/**
+ * @brief ATC 상담원 목록 (필드별 연속 배열, 같은 인덱스가 같은 상담원)
+ *
+ * 현재 스레드의 디코딩용 메모리 리소스에 할당한다.
+ */
+struct ATCAgentColumns {
+  std::pmr::vector<common::AgentIDString> atc_agent_ids{
+      common::getDecodeResource()};
+  std::pmr::vector<std::uint16_t> agent_flags{common::getDecodeResource()};
+  std::pmr::vector<std::uint16_t> atc_agent_states{
+      common::getDecodeResource()};
+  std::pmr::vector<std::uint16_t> atc_agent_state_durations{
+      common::getDecodeResource()};
+
+  /**
+   * @brief 상담원 수
+   *
+   * @return std::size_t
+   */
+  std::size_t size() const { return atc_agent_ids.size(); }
+
+  /**
+   * @brief 모든 배열의 크기를 맞춘다
+   *
+   * @param size
+   */
+  void resize(const std::size_t size) {
+    atc_agent_ids.resize(size);
+    agent_flags.resize(size);
+    atc_agent_states.resize(size);
+    atc_agent_state_durations.resize(size);
+  }
 };
 
 class AgentTeamConfigEvent {
@@ -75,17 +109,15 @@ public:
   /**
    * @brief Get the Agent Team Name object
    *
-   * @return constexpr std::string
+   * @return std::string_view
    */
-  constexpr std::string getAgentTeamName() const {
-    return agent_team_name.value_or("");
-  }
+  std::string_view getAgentTeamName() const { return agent_team_name; }
   /**
-   * @brief Get the ATC Agent List object
+   * @brief Get the ATC Agents object
    *
-   * @return const std::vector<ATCAgent>
+   * @return const ATCAgentColumns&
    */
-  const std::vector<ATCAgent> getATCAgentList() const { return atc_agent_list; }
+  const ATCAgentColumns &getATCAgents() const { return atc_agents; }
 
   /**
    * @brief
@@ -137,121 +169,163 @@ public:
    * @param agent_team_name
    */
   void setAgentTeamName(const std::string_view agent_team_name) {
-    this->agent_team_name = agent_team_name.data();
+    this->agent_team_name.assign(
+        agent_team_name.substr(0, agent_team_name.find('\0')));
   }
   /**
-   * @brief Set the ATC Agent List object
+   * @brief Set the ATC Agents object
    *
-   * @param atc_agent_list
+   * @param atc_agents
    */
-  void setATCAgentList(const std::vector<ATCAgent> &atc_agent_list) {
-    this->atc_agent_list = atc_agent_list;
+  void setATCAgents(ATCAgentColumns &&atc_agents) {
+    this->atc_agents = std::move(atc_agents);
   }
 
 protected:
 private:
   // 고정 데이터 영역
-  cisco::common::MHDR mhdr;
-  std::uint32_t peripheral_id;
-  std::uint32_t team_id;
-  std::uint16_t number_of_agents;
-  std::uint16_t config_operation;
-  std::int32_t department_id;
-  // 가변 데이터 영역
-  std::optional<std::string> agent_team_name;
-  std::vector<ATCAgent> atc_agent_list{};
+  cisco::common::MHDR mhdr{};
+  std::uint32_t peripheral_id{};
+  std::uint32_t team_id{};
+  std::uint16_t number_of_agents{};
+  std::uint16_t config_operation{};
+  std::int32_t department_id{};
+  // 가변 데이터 영역 (현재 스레드의 디코딩용 메모리 리소스에 할당한다)
+  std::pmr::string agent_team_name{common::getDecodeResource()};
+  ATCAgentColumns atc_agents{};
 };
 } // namespace cisco::supervisor
 
-template <>
-inline const cisco::supervisor::AgentTeamConfigEvent
-cisco::common::deserialize(const std::vector<std::byte> &bytes) {
-  cisco::supervisor::AgentTeamConfigEvent agent_team_config_event{};
+namespace cisco::supervisor::detail {
+/**
+ * @brief AGENT_TEAM_CONFIG_EVENT 가변 영역 디코딩 상태
+ *
+ * ATC_AGENT_ID_TAG 마다 다음 상담원으로 넘어가고, 뒤따르는 태그는 현재
+ * 상담원 자리에 바로 기록한다.
+ */
+struct ATCDecodeContext {
+  AgentTeamConfigEvent &agent_team_config_event;
+  ATCAgentColumns atc_agents{};
+  std::size_t atc_agent_count{0};
+};
 
-  size_t packet_index = 0;
-  size_t field_length = 8;
+inline void decodeAgentTeamName(const std::span<const std::byte> data,
+                                ATCDecodeContext &context) {
+  context.agent_team_config_event.setAgentTeamName(
+      common::detail::loadFloating<std::string_view>(data));
+}
 
-  agent_team_config_event.setMHDR(deserialize<cisco::common::MHDR>(
-      std::vector<std::byte>{bytes.cbegin() + packet_index,
-                             bytes.cbegin() + packet_index + field_length}));
-  packet_index += field_length;
+inline void decodeATCAgentID(const std::span<const std::byte> data,
+                             ATCDecodeContext &context) {
+  const std::size_t index = context.atc_agent_count++;
+  // NumberOfAgents 보다 많이 들어온 경우에만 배열을 늘린다
+  if (index >= context.atc_agents.size()) {
+    context.atc_agents.resize(index + 1);
+  }
 
-  field_length = 4;
-  agent_team_config_event.setPeripheralID(deserialize<std::uint32_t>(
-      std::vector<std::byte>{bytes.cbegin() + packet_index,
-                             bytes.cbegin() + packet_index + field_length}));
-  packet_index += field_length;
+  context.atc_agents.atc_agent_ids[index] =
+      common::detail::loadFloating<std::string_view>(data);
+}
 
-  field_length = 4;
-  agent_team_config_event.setTeamID(deserialize<std::uint32_t>(
-      std::vector<std::byte>{bytes.cbegin() + packet_index,
-                             bytes.cbegin() + packet_index + field_length}));
-  packet_index += field_length;
+inline void decodeAgentFlags(const std::span<const std::byte> data,
+                             ATCDecodeContext &context) {
+  // 상담원 ID 보다 먼저 들어온 태그는 기록할 자리가 없으므로 버린다
+  if (context.atc_agent_count == 0) {
+    return;
+  }
 
-  field_length = 2;
-  agent_team_config_event.setNumberOfAgents(deserialize<std::uint16_t>(
-      std::vector<std::byte>{bytes.cbegin() + packet_index,
-                             bytes.cbegin() + packet_index + field_length}));
-  packet_index += field_length;
+  context.atc_agents.agent_flags[context.atc_agent_count - 1] =
+      common::deserialize<std::uint16_t>(data);
+}
 
-  field_length = 2;
-  agent_team_config_event.setConfigOperation(deserialize<std::uint16_t>(
-      std::vector<std::byte>{bytes.cbegin() + packet_index,
-                             bytes.cbegin() + packet_index + field_length}));
-  packet_index += field_length;
+inline void decodeATCAgentState(const std::span<const std::byte> data,
+                                ATCDecodeContext &context) {
+  if (context.atc_agent_count == 0) {
+    return;
+  }
 
-  field_length = 4;
-  agent_team_config_event.setDepartmentID(deserialize<std::int32_t>(
-      std::vector<std::byte>{bytes.cbegin() + packet_index,
-                             bytes.cbegin() + packet_index + field_length}));
-  packet_index += field_length;
+  context.atc_agents.atc_agent_states[context.atc_agent_count - 1] =
+      common::deserialize<std::uint16_t>(data);
+}
 
-  std::vector<supervisor::ATCAgent> atc_agent_list{};
-  while (packet_index <
-         agent_team_config_event.getMHDR().getMessageLength() + 8) {
-    cisco::common::FloatingData floating_data =
-        deserialize<cisco::common::FloatingData>(std::vector<std::byte>{
-            bytes.cbegin() + packet_index, bytes.cend()});
-    packet_index += floating_data.getData().size() + 4;
+inline void decodeATCAgentStateDuration(const std::span<const std::byte> data,
+                                        ATCDecodeContext &context) {
+  if (context.atc_agent_count == 0) {
+    return;
+  }
 
-    switch (floating_data.getTag()) {
-    case TagValue::AGENT_TEAM_NAME_TAG: {
-      std::string agent_team_name;
-      agent_team_name.resize(floating_data.getData().size());
-      std::memcpy(agent_team_name.data(), floating_data.getData().data(),
-                  floating_data.getData().size());
-      agent_team_config_event.setAgentTeamName(agent_team_name);
-    } break;
-    case TagValue::ATC_AGENT_ID_TAG: {
-      std::string agent_id;
-      agent_id.resize(floating_data.getData().size());
-      std::memcpy(agent_id.data(), floating_data.getData().data(),
-                  floating_data.getData().size());
+  context.atc_agents.atc_agent_state_durations[context.atc_agent_count - 1] =
+      common::deserialize<std::uint16_t>(data);
+}
+} // namespace cisco::supervisor::detail
 
-      supervisor::ATCAgent atc_agent{};
-      atc_agent.atc_agent_id = agent_id;
+namespace cisco::common {
+/**
+ * @brief AGENT_TEAM_CONFIG_EVENT 고정 영역 레이아웃
+ *
+ */
+template <>
+struct MessageLayout<supervisor::AgentTeamConfigEvent>
+    : FieldLayout<
+          Field<&supervisor::AgentTeamConfigEvent::getPeripheralID,
+                &supervisor::AgentTeamConfigEvent::setPeripheralID>,
+          Field<&supervisor::AgentTeamConfigEvent::getTeamID,
+                &supervisor::AgentTeamConfigEvent::setTeamID>,
+          Field<&supervisor::AgentTeamConfigEvent::getNumberOfAgent,
+                &supervisor::AgentTeamConfigEvent::setNumberOfAgents>,
+          Field<&supervisor::AgentTeamConfigEvent::getConfigOperation,
+                &supervisor::AgentTeamConfigEvent::setConfigOperation>,
+          Field<&supervisor::AgentTeamConfigEvent::getDepartmentID,
+                &supervisor::AgentTeamConfigEvent::setDepartmentID>> {};
 
-      atc_agent_list.emplace_back(atc_agent);
-    } break;
-    case TagValue::AGENT_FLAGS_TAG: {
-      atc_agent_list.at(atc_agent_list.size() - 1).agent_flag =
-          deserialize<std::uint16_t>(floating_data.getData());
-    } break;
-    case TagValue::ATC_AGENT_STATE_TAG: {
-      atc_agent_list.at(atc_agent_list.size() - 1).atc_agent_state =
-          deserialize<std::uint16_t>(floating_data.getData());
-    } break;
-    case TagValue::ATC_AGENT_STATE_DURATION_TAG: {
-      atc_agent_list.at(atc_agent_list.size() - 1).atc_agent_state_duration =
-          deserialize<std::uint16_t>(floating_data.getData());
-    } break;
-    default:
-      break;
-    }
-  }
-  agent_team_config_event.setATCAgentList(atc_agent_list);
+/**
+ * @brief AGENT_TEAM_CONFIG_EVENT 가변 영역 레이아웃
+ *
+ */
+template <>
+struct MessageFloatingLayout<supervisor::AgentTeamConfigEvent>
+    : FloatingLayout<
+          supervisor::detail::ATCDecodeContext,
+          FloatingField<TagValue::AGENT_TEAM_NAME_TAG,
+                        &supervisor::detail::decodeAgentTeamName>,
+          FloatingField<TagValue::ATC_AGENT_ID_TAG,
+                        &supervisor::detail::decodeATCAgentID>,
+          FloatingField<TagValue::AGENT_FLAGS_TAG,
+                        &supervisor::detail::decodeAgentFlags>,
+          FloatingField<TagValue::ATC_AGENT_STATE_TAG,
+                        &supervisor::detail::decodeATCAgentState>,
+          FloatingField<TagValue::ATC_AGENT_STATE_DURATION_TAG,
+                        &supervisor::detail::decodeATCAgentStateDuration>> {};
+} // namespace cisco::common
+
+template <>
+inline const cisco::supervisor::AgentTeamConfigEvent
+cisco::common::deserialize(const std::span<const std::byte> bytes,
+                           const DecodeMask mask) {
+  cisco::supervisor::AgentTeamConfigEvent agent_team_config_event{};
+  ByteReader reader{bytes};
+
+  agent_team_config_event.setMHDR(reader.read<cisco::common::MHDR>());
+  MessageLayout<supervisor::AgentTeamConfigEvent>::decode(
+      reader, agent_team_config_event, mask.fixed);
+
+  // 상담원 배열은 NumberOfAgents 만큼 한 번에 잡아두고, 실제 수만큼 줄인다
+  supervisor::detail::ATCDecodeContext context{agent_team_config_event};
+  context.atc_agents.resize(agent_team_config_event.getNumberOfAgent());
+
+  MessageFloatingLayout<supervisor::AgentTeamConfigEvent>::decode(
+      reader, agent_team_config_event.getMHDR().getMessageLength() + 8,
+      context, mask.floating);
+  context.atc_agents.resize(context.atc_agent_count);
+  agent_team_config_event.setATCAgents(std::move(context.atc_agents));
 
   return agent_team_config_event;
 }
 
+template <>
+inline const cisco::supervisor::AgentTeamConfigEvent
+cisco::common::deserialize(const std::span<const std::byte> bytes) {
+  return deserialize<cisco::supervisor::AgentTeamConfigEvent>(bytes, DecodeMask::all());
+}
+
 #endif
\ No newline at end of file
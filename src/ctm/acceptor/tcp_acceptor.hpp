@@ -5,6 +5,7 @@
 
 #include "../../util/ini_loader.h"
 #include "../handler/tcp_handler.hpp"
+#include "../io_loop.hpp"
 #include "./acceptor.hpp"
 
 #include <asio/awaitable.hpp>
@@ -23,7 +24,6 @@
 #include <exception>
 #include <filesystem>
 #include <optional>
-#include <thread>
 #include <unordered_map>
 
 namespace ctm::acceptor {
@@ -38,7 +38,7 @@ public:
    *
    */
   TCPAcceptor()
-      : io_context(std::thread::hardware_concurrency()),
+      : io_context(IOLoop::getInstance()->getContext()),
         endpoint(asio::ip::tcp::v4(), util::IniLoader::getInstance()->get(
                                           "server", "tcp.port", 5110)),
         acceptor(io_context, endpoint) {
@@ -78,18 +78,13 @@ public:
   virtual ~TCPAcceptor() = default;
 
   /**
-   * @brief TCP 클라이언트 접속 스레드 실행
+   * @brief 공유 I/O 루프에서 TCP 클라이언트 접속 대기 시작
    *
    */
   virtual void accept() noexcept override {
-    std::thread accept_thread{[&]() {
-      spdlog::info("TCP Acceptor started. port: {}, ssl_enabled: {}",
-                   endpoint.port(), ssl_context.has_value());
-      startAccept();
-      io_context.run();
-    }};
-
-    accept_thread.detach();
+    spdlog::info("TCP Acceptor started. port: {}, ssl_enabled: {}",
+                 endpoint.port(), ssl_context.has_value());
+    startAccept();
   }
 
   /**
@@ -154,7 +149,7 @@ protected:
   }
 
 private:
-  asio::io_context io_context;
+  asio::io_context &io_context;
   std::optional<asio::ssl::context> ssl_context;
   asio::ip::tcp::endpoint endpoint;
   asio::ip::tcp::acceptor acceptor;
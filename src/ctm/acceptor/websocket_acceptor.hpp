@@ -5,6 +5,7 @@
 
 #include "../../util/ini_loader.h"
 #include "../handler/websocket_handler.hpp"
+#include "../io_loop.hpp"
 #include "./acceptor.hpp"
 
 #include <asio/awaitable.hpp>
@@ -22,7 +23,6 @@
 #include <filesystem>
 #include <memory>
 #include <optional>
-#include <thread>
 #include <unordered_map>
 
 namespace ctm::acceptor {
@@ -33,7 +33,7 @@ public:
    *
    */
   WebsocketAcceptor()
-      : io_context(std::thread::hardware_concurrency()),
+      : io_context(IOLoop::getInstance()->getContext()),
         endpoint(asio::ip::tcp::v4(), util::IniLoader::getInstance()->get(
                                           "server", "websocket.port", 8085)),
         acceptor(io_context, endpoint) {
@@ -73,18 +73,13 @@ public:
   virtual ~WebsocketAcceptor() = default;
 
   /**
-   * @brief 웹 소켓 클라이언트 접속 스레드 실행
+   * @brief 공유 I/O 루프에서 웹 소켓 클라이언트 접속 대기 시작
    *
    */
   virtual void accept() noexcept override {
-    std::thread accept_thread([&]() {
-      spdlog::info("Websocket Acceptor startd. port: {}, ssl_enabled: {}",
-                   endpoint.port(), ssl_context.has_value());
-      startAccept();
-      io_context.run();
-    });
-
-    accept_thread.detach();
+    spdlog::info("Websocket Acceptor startd. port: {}, ssl_enabled: {}",
+                 endpoint.port(), ssl_context.has_value());
+    startAccept();
   }
 
   /**
@@ -150,7 +145,7 @@ protected:
   }
 
 private:
-  asio::io_context io_context;
+  asio::io_context &io_context;
   std::optional<asio::ssl::context> ssl_context;
   asio::ip::tcp::endpoint endpoint;
   asio::ip::tcp::acceptor acceptor;
@@ -5,6 +5,7 @@
 
 #include "../channel/event/bridge_event.hpp"
 #include "../channel/event_channel.hpp"
+#include "../cisco/common/fixed_string.hpp"
 
 #include <msgpack.hpp>
 #include <spdlog/spdlog.h>
@@ -14,6 +15,40 @@
 #include <string>
 #include <string_view>
 
+namespace msgpack {
+MSGPACK_API_VERSION_NAMESPACE(MSGPACK_DEFAULT_API_NS) {
+  namespace adaptor {
+  /**
+   * @brief FixedString 은 msgpack 문자열로 변환한다
+   *
+   * @tparam N
+   */
+  template <std::size_t N> struct convert<cisco::common::FixedString<N>> {
+    const msgpack::object &operator()(const msgpack::object &obj,
+                                      cisco::common::FixedString<N> &v) const {
+      if (obj.type != msgpack::type::STR) {
+        throw msgpack::type_error();
+      }
+
+      v.assign(std::string_view{obj.via.str.ptr, obj.via.str.size});
+      return obj;
+    }
+  };
+
+  template <std::size_t N> struct pack<cisco::common::FixedString<N>> {
+    template <typename Stream>
+    msgpack::packer<Stream> &
+    operator()(msgpack::packer<Stream> &o,
+               const cisco::common::FixedString<N> &v) const {
+      o.pack_str(static_cast<std::uint32_t>(v.size()));
+      o.pack_str_body(v.data(), static_cast<std::uint32_t>(v.size()));
+      return o;
+    }
+  };
+  } // namespace adaptor
+}
+} // namespace msgpack
+
 namespace ctm {
 /**
  * @brief 상담원 상태
@@ -40,7 +75,8 @@ public:
    * @return false
    */
   constexpr bool operator==(const AgentInfo &rhs) const {
-    return getAgentID() == rhs.getAgentID();
+    return getPeripheralID() == rhs.getPeripheralID() &&
+           getAgentID() == rhs.getAgentID();
   }
 
   /**
@@ -52,9 +88,9 @@ public:
   /**
    * @brief Get the Agent I D object
    *
-   * @return const std::string
+   * @return std::string_view
    */
-  const std::string getAgentID() const { return agent_id; }
+  constexpr std::string_view getAgentID() const { return agent_id.view(); }
   /**
    * @brief Get the Agent State object
    *
@@ -88,9 +124,15 @@ public:
   /**
    * @brief Get the Extension object
    *
-   * @return const std::string
+   * @return std::string_view
    */
-  const std::string getExtension() const { return extension; }
+  constexpr std::string_view getExtension() const { return extension.view(); }
+  /**
+   * @brief Get the Peripheral ID object
+   *
+   * @return constexpr std::uint32_t
+   */
+  constexpr std::uint32_t getPeripheralID() const { return peripheral_id; }
 
   /**
    * @brief Set the ICM Agent ID object
@@ -106,7 +148,7 @@ public:
    * @param agent_id
    */
   void setAgentID(const std::string_view agent_id) {
-    this->agent_id = agent_id.data();
+    this->agent_id = agent_id;
   }
   /**
    * @brief Set the Agent State object
@@ -185,10 +227,18 @@ public:
       this->extension = "";
       break;
     default:
-      this->extension = extension.data();
+      this->extension = extension;
       break;
     }
   }
+  /**
+   * @brief Set the Peripheral ID object
+   *
+   * @param peripheral_id
+   */
+  void setPeripheralID(const std::uint32_t peripheral_id) {
+    this->peripheral_id = peripheral_id;
+  }
 
   /**
    * @brief 데이터 변경 내용을 클라이언트에게 브로드 캐스팅 하는 메소드
@@ -240,12 +290,13 @@ public:
   }
 
   MSGPACK_DEFINE(icm_agent_id, agent_id, agent_state, state_duration,
-                 reason_code, skill_group_id, direction, extension);
+                 reason_code, skill_group_id, direction, extension,
+                 peripheral_id);
 
 protected:
 private:
   std::int32_t icm_agent_id{0};
-  std::string agent_id{""};
+  cisco::common::AgentIDString agent_id{};
   std::uint16_t agent_state{0};
   std::uint64_t state_duration{static_cast<std::uint64_t>(
       std::chrono::duration_cast<std::chrono::seconds>(
@@ -254,7 +305,8 @@ private:
   std::uint16_t reason_code{0};
   std::uint16_t skill_group_id{0};
   std::uint32_t direction{0};
-  std::string extension{""};
+  cisco::common::AgentExtensionString extension{};
+  std::uint32_t peripheral_id{0};
 };
 } // namespace ctm
 
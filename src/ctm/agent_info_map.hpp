@@ -3,12 +3,43 @@
 #ifndef _CTM_CTM_AGENT_INFO_MAP_HPP_
 #define _CTM_CTM_AGENT_INFO_MAP_HPP_
 
+#include "../cisco/common/fixed_string.hpp"
 #include "../template/singleton.hpp"
 #include "./agent_info.hpp"
 
-#include <algorithm>
-#include <string_view>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
 #include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace ctm {
+/**
+ * @brief 상담원 맵의 키 (상담원 ID 는 Peripheral 안에서만 유일하다)
+ *
+ */
+struct AgentKey {
+  std::uint32_t peripheral_id;
+  cisco::common::AgentIDString agent_id;
+
+  constexpr bool operator==(const AgentKey &rhs) const {
+    return peripheral_id == rhs.peripheral_id && agent_id == rhs.agent_id;
+  }
+};
+} // namespace ctm
+
+/**
+ * @brief AgentKey 해시 (상담원 ID 해시에 Peripheral ID 를 섞는다)
+ *
+ */
+template <> struct std::hash<ctm::AgentKey> {
+  std::size_t operator()(const ctm::AgentKey &key) const noexcept {
+    return key.agent_id.hash() ^ (static_cast<std::size_t>(key.peripheral_id) *
+                                  0x9e3779b97f4a7c15ULL);
+  }
+};
 
 namespace ctm {
 /**
@@ -29,29 +60,44 @@ public:
   virtual ~AgentInfoMap() = default;
 
   /**
-   * @brief 내부 맵을을 가져온다
+   * @brief 상담원 상태를 잠금 안에서 갱신하고 갱신된 사본을 반환한다 (없으면
+   * 새로 만든다)
    *
-   * @return std::unordered_map<std::string, AgentInfo>&
+   * 세션마다 다른 스레드에서 갱신하므로 맵은 이 함수로만 고친다. 배포는 반환된
+   * 사본으로 잠금 밖에서 한다.
+   *
+   * @tparam Updater void(AgentInfo &)
+   * @param agent_key
+   * @param updater
+   * @return AgentInfo
    */
-  std::unordered_map<std::string, AgentInfo> &get() { return inner_map; }
+  template <typename Updater>
+  AgentInfo update(const AgentKey &agent_key, Updater &&updater) {
+    std::lock_guard<std::mutex> lock{mutex};
+    AgentInfo &agent_info = inner_map[agent_key];
+    updater(agent_info);
+    return agent_info;
+  }
 
   /**
-   * @brief 해당 상담직원이 이미 맵맵에 있는지 판단
+   * @brief 전체 상담원 상태의 사본
    *
-   * @param agent_id
-   * @return true
-   * @return false
+   * @return std::vector<AgentInfo>
    */
-  const bool exists(const std::string_view agent_id) const {
-    return std::find_if(inner_map.cbegin(), inner_map.cend(),
-                        [&](const std::pair<std::string, AgentInfo> &info) {
-                          return info.first == agent_id.data();
-                        }) == inner_map.cend();
+  std::vector<AgentInfo> snapshot() const {
+    std::lock_guard<std::mutex> lock{mutex};
+    std::vector<AgentInfo> agent_infos{};
+    agent_infos.reserve(inner_map.size());
+    for (const std::pair<const AgentKey, AgentInfo> &element : inner_map) {
+      agent_infos.emplace_back(element.second);
+    }
+    return agent_infos;
   }
 
 protected:
 private:
-  std::unordered_map<std::string, AgentInfo> inner_map{};
+  mutable std::mutex mutex{};
+  std::unordered_map<AgentKey, AgentInfo> inner_map{};
 };
 } // namespace ctm
 
@@ -9,8 +9,9 @@
 #include "../../channel/event/event.hpp"
 #include "../../channel/event_channel.hpp"
 #include "../../channel/subscriber.hpp"
+#include "../../cisco/common/decode_resource.hpp"
 #include "../../cisco/control/query_agent_state_conf.hpp"
-#include "../../cisco/message/agent_state_event.hpp"
+#include "../../cisco/message/agent_state_event_view.hpp"
 #include "../../cisco/miscellaneous/system_event.hpp"
 #include "../../cisco/session/heartbeat_conf.hpp"
 #include "../../cisco/session/open_conf.hpp"
@@ -18,10 +19,19 @@
 #include "../../template/singleton.hpp"
 #include "../agent_info.hpp"
 #include "../agent_info_map.hpp"
+#include "./message_dispatcher.hpp"
 
 #include <spdlog/spdlog.h>
 
+#include <atomic>
+#include <cstddef>
 #include <cstdint>
+#include <exception>
+#include <optional>
+#include <span>
+#include <sstream>
+#include <string>
+#include <vector>
 
 namespace ctm::bridge {
 
@@ -33,6 +43,9 @@ public:
    *
    */
   MessageBridge() {
+    // 세션별 이벤트 처리 스레드들이 함께 쓰므로 상담원 맵은 미리 만들어 둔다
+    AgentInfoMap::getInstance();
+
     channel::EventChannel<channel::event::ClientEvent>::getInstance()
         ->subscribe(this);
     channel::EventChannel<channel::event::CTIEvent>::getInstance()->subscribe(
@@ -59,232 +72,44 @@ public:
     switch (event->getEventType()) {
       // CTI 메시지는 파싱하여 클라이언트들에게 던져준다
     case channel::event::EventType::CTI_EVENT: {
-      spdlog::debug("MessageBridge received CTI Event");
       const channel::event::CTIEvent *cti_event =
           dynamic_cast<const channel::event::CTIEvent *>(event);
-
-      switch (cti_event->getMessageType()) {
-      case cisco::common::MessageType::OPEN_CONF: {
-        const cisco::session::OpenConf open_conf =
-            cisco::common::deserialize<cisco::session::OpenConf>(
-                cti_event->getPacket());
-
-        spdlog::debug(
-            "Open conf event recieved. invoke_id: {}, service_granted: {}, "
-            "monitor_id: {}, pg_status: {}, icm_central_controller_time: {}, "
-            "peripheral_online: {}, peripheral_type: {}, agent_state: {}, "
-            "department_id: {}, session_type: {}, agent_extension: {}, "
-            "agent_id: {}, agent_instrument: {}, num_peripherals: {}, "
-            "flt_peripheral_id: {}, multiline_agent_control: {}",
-            open_conf.getInvokeID(), open_conf.getServiceGranted(),
-            open_conf.getMonitorID(), open_conf.getPGStatus(),
-            open_conf.getICMCentralControllerTime(),
-            open_conf.getPeripheralOnline(), open_conf.getPeripheralType(),
-            open_conf.getAgentState(), open_conf.getDepartmentID(),
-            open_conf.getSessionType(), open_conf.getAgentExtension(),
-            open_conf.getAgentID(), open_conf.getAgentInstrument(),
-            open_conf.getNumPeripherals(), open_conf.getFltPeripheralID(),
-            open_conf.getMultilineAgentControl());
-      } break;
-      // Heartbeat 응답
-      case cisco::common::MessageType::HEARTBEAT_CONF: {
-        const cisco::session::HeartbeatConf heart_beat_conf =
-            cisco::common::deserialize<cisco::session::HeartbeatConf>(
-                cti_event->getPacket());
-        spdlog::info("HEARTBEAT_CONF received. invoke_id: {}",
-                     heart_beat_conf.getInvokeID());
-      } break;
-      case cisco::common::MessageType::AGENT_STATE_EVENT: {
-        // AGENT_STATE_EVENT 응답
-        const cisco::message::AgentStateEvent agent_state_event =
-            cisco::common::deserialize<cisco::message::AgentStateEvent>(
-                cti_event->getPacket());
-        spdlog::info(
-            "AGENT_STATE_EVENT received. agent_state: {}, "
-            "event_reason_code: {}, icm_agent_id: {}, agent_id: {}, "
-            "agent_extension: {}, skill_group_id: {}, "
-            "skill_Group_number: {}, state_duration: {}, direction: {}, "
-            "mrd_id: {}, peripheral_id: {}",
-            agent_state_event.getAgentState(),
-            agent_state_event.getEventReasonCode(),
-            agent_state_event.getICMAgentID(), agent_state_event.getAgentID(),
-            agent_state_event.getAgentExtension(),
-            agent_state_event.getSkillGroupID(),
-            agent_state_event.getSkillGroupNumber(),
-            agent_state_event.getStateDuration(),
-            agent_state_event.getDirection(), agent_state_event.getMRDID(),
-            agent_state_event.getPeripheralID());
-
-        // 상담원 맵에 저장
-        if (AgentInfoMap::getInstance()->exists(
-                agent_state_event.getAgentID())) {
-          AgentInfo agent_info{};
-          agent_info.setAgentID(agent_state_event.getAgentID());
-          agent_info.setAgentState(agent_state_event.getAgentState());
-          agent_info.setICMAgentID(agent_state_event.getICMAgentID());
-          agent_info.setStateDuration(agent_state_event.getStateDuration());
-          agent_info.setDirection(agent_state_event.getDirection());
-          agent_info.setExtension(agent_state_event.getAgentExtension());
-          agent_info.setReasonCode(agent_state_event.getEventReasonCode());
-          agent_info.setSkillGroupID(agent_state_event.getSkillGroupID());
-
-          AgentInfoMap::getInstance()->get().emplace(
-              agent_state_event.getAgentID(), agent_info);
-
-          agent_info.broadcast();
-        } else {
-          AgentInfo &agent_info = AgentInfoMap::getInstance()->get().at(
-              agent_state_event.getAgentID());
-
-          agent_info.setAgentID(agent_state_event.getAgentID());
-          agent_info.setAgentState(agent_state_event.getAgentState());
-          agent_info.setICMAgentID(agent_state_event.getICMAgentID());
-          agent_info.setStateDuration(agent_state_event.getStateDuration());
-          agent_info.setDirection(agent_state_event.getDirection());
-          agent_info.setExtension(agent_state_event.getAgentExtension());
-          agent_info.setReasonCode(agent_state_event.getEventReasonCode());
-          agent_info.setSkillGroupID(agent_state_event.getSkillGroupID());
-
-          agent_info.broadcast();
-        }
-      } break;
-      case cisco::common::MessageType::QUERY_AGENT_STATE_CONF: {
-        // QUERY_AGENT_STATE_CONF 응답
-        const cisco::control::QueryAgentStateConf query_agent_state_conf =
-            cisco::common::deserialize<cisco::control::QueryAgentStateConf>(
-                cti_event->getPacket());
-        spdlog::info(
-            "QUERY_AGENT_STATE_CONF received. agent_id: {}, agent_state: {}, "
-            "agent_extension: {}, skill_group_id: {}, "
-            "skill_group_number: {}, icm_agent_id: {}",
-            query_agent_state_conf.getAgentID(),
-            query_agent_state_conf.getAgentState(),
-            query_agent_state_conf.getAgentExtension(),
-            query_agent_state_conf.getSkillGroupID(),
-            query_agent_state_conf.getSkillGroupNumber(),
-            query_agent_state_conf.getICMAgentID());
-
-        // 상담원 맵에 저장
-        if (AgentInfoMap::getInstance()->exists(
-                query_agent_state_conf.getAgentID())) {
-          AgentInfo agent_info{};
-          agent_info.setAgentID(query_agent_state_conf.getAgentID());
-          agent_info.setAgentState(query_agent_state_conf.getAgentState());
-          agent_info.setICMAgentID(query_agent_state_conf.getICMAgentID());
-          agent_info.setExtension(query_agent_state_conf.getAgentExtension());
-          agent_info.setSkillGroupID(query_agent_state_conf.getSkillGroupID());
-
-          AgentInfoMap::getInstance()->get().emplace(
-              query_agent_state_conf.getAgentID(), agent_info);
-
-          agent_info.broadcast();
-        } else {
-          AgentInfo &agent_info = AgentInfoMap::getInstance()->get().at(
-              query_agent_state_conf.getAgentID());
-
-          agent_info.setAgentID(query_agent_state_conf.getAgentID());
-          agent_info.setAgentState(query_agent_state_conf.getAgentState());
-          agent_info.setICMAgentID(query_agent_state_conf.getICMAgentID());
-          agent_info.setExtension(query_agent_state_conf.getAgentExtension());
-          agent_info.setSkillGroupID(query_agent_state_conf.getSkillGroupID());
-
-          agent_info.broadcast();
-        }
-      } break;
-      case cisco::common::MessageType::AGENT_TEAM_CONFIG_EVENT: {
-        // AGENT_TEAM_CONF_EVENT 응답
-        const cisco::supervisor::AgentTeamConfigEvent agent_team_config_event =
-            cisco::common::deserialize<cisco::supervisor::AgentTeamConfigEvent>(
-                cti_event->getPacket());
-
-        std::ostringstream atc_agent_stream;
-        for (const cisco::supervisor::ATCAgent &agent :
-             agent_team_config_event.getATCAgentList()) {
-          atc_agent_stream << "{agent_id: " << agent.atc_agent_id.data()
-                           << ", flag: " << agent.agent_flag
-                           << ", state: " << agent.atc_agent_state
-                           << ", duration: " << agent.atc_agent_state_duration
-                           << "}, ";
-
-          // CTI 에게 메시지 배포 (peripheralid-agentid)
-          std::ostringstream bridge_message_stream{};
-          bridge_message_stream << agent_team_config_event.getPeripheralID()
-                                << "-" << agent.atc_agent_id.data();
-          bridge_message_stream.flush();
-
-          std::vector<std::byte> bridge_message{};
-          for (const char ch : bridge_message_stream.str()) {
-            bridge_message.emplace_back(static_cast<std::byte>(ch));
-          }
-
-          channel::EventChannel<channel::event::BridgeEvent>::getInstance()
-              ->publish(channel::event::BridgeEvent{
-                  channel::event::BridgeEvent::BridgeEventDestination::CTI,
-                  channel::event::BridgeEvent::BridgeEventMessage{
-                      .type = channel::event::BridgeEvent::BridgeEventType::
-                          QUERY_AGENT,
-                      .message = bridge_message}});
-
-          // 상담원 맵에 저장
-          if (AgentInfoMap::getInstance()->exists(agent.atc_agent_id.data())) {
-            AgentInfo agent_info{};
-            agent_info.setAgentID(agent.atc_agent_id.data());
-            agent_info.setAgentState(agent.atc_agent_state);
-            agent_info.setStateDuration(agent.atc_agent_state_duration);
-
-            AgentInfoMap::getInstance()->get().emplace(
-                agent.atc_agent_id.data(), agent_info);
-
-            agent_info.broadcast();
-          } else {
-            AgentInfo &agent_info = AgentInfoMap::getInstance()->get().at(
-                agent.atc_agent_id.data());
-
-            agent_info.setAgentID(agent.atc_agent_id.data());
-            agent_info.setAgentState(agent.atc_agent_state);
-            agent_info.setStateDuration(agent.atc_agent_state_duration);
-
-            agent_info.broadcast();
+      spdlog::debug("MessageBridge received CTI Event. packet_count: {}",
+                    cti_event->getPacketCount());
+
+      // 디코딩 결과는 수신 배치 아레나에 할당한다
+      const cisco::common::ScopedDecodeResource decode_resource{
+          cti_event->getMemoryResource()};
+
+      // 묶음의 메시지를 순서대로 등록된 핸들러로 전달하고, 처리하지 않는
+      // 메시지는 개수만 센다. 디코딩에 실패한 메시지는 건너뛰고 다음 메시지를
+      // 처리한다
+      std::uint64_t unhandled = 0;
+      std::uint64_t decode_failed = 0;
+      for (std::size_t i = 0; i < cti_event->getPacketCount(); i++) {
+        const cisco::common::MessageType message_type =
+            cti_event->getMessageType(i);
+        try {
+          if (!Dispatcher::dispatch(*this, message_type,
+                                    cti_event->getPacket(i), *cti_event)) {
+            unhandled++;
           }
+        } catch (const std::exception &e) {
+          decode_failed++;
+          spdlog::error("Unable to decode CTI message. message_type: {}, "
+                        "frame_index: {}, frame_count: {}, reason: {}",
+                        static_cast<std::uint32_t>(message_type), i,
+                        cti_event->getPacketCount(), e.what());
         }
+      }
 
-        spdlog::info(
-            "AGENT_TEAM_CONF received. peripheral_id: {}, team_id: {}, "
-            "number_of_agent: {}, config_operation: {}, department_id: {}, "
-            "agent_team_name: {}, atc_agent_list: [{}]",
-            agent_team_config_event.getPeripheralID(),
-            agent_team_config_event.getTeamID(),
-            agent_team_config_event.getNumberOfAgent(),
-            agent_team_config_event.getConfigOperation(),
-            agent_team_config_event.getDepartmentID(),
-            agent_team_config_event.getAgentTeamName(), atc_agent_stream.str());
-      } break;
-      case cisco::common::MessageType::SYSTEM_EVENT: {
-        // SYSTEM_EVENT 응답
-        const cisco::misc::SystemEvent system_event =
-            cisco::common::deserialize<cisco::misc::SystemEvent>(
-                cti_event->getPacket());
-
-        spdlog::info(
-            "SYSTEM_EVENT received. pg_status: {}, "
-            "icm_central_controller_time: {}, "
-            "system_event_id: {}, system_event_arg_1: {}, "
-            "system_event_arg_2: "
-            "{}, system_event_arg_3: {}, event_device_type: {}, text: {}, "
-            "event_device_id: {}",
-            system_event.getPGStatus(),
-            system_event.getICMCentralControllerTime(),
-            system_event.getSystemEventID(), system_event.getSystemEventArg1(),
-            system_event.getSystemEventArg2(),
-            system_event.getSystemEventArg3(),
-            system_event.getEventDeviceType(), system_event.getText(),
-            system_event.getEventDeviceID());
-      } break;
-      default:
-        spdlog::info(
-            "CTI Event received. (non-handled message type) message_type: {}",
-            static_cast<std::int32_t>(cti_event->getMessageType()));
-        break;
+      if (unhandled != 0) {
+        unhandled_message_count.fetch_add(unhandled,
+                                          std::memory_order_relaxed);
+      }
+      if (decode_failed != 0) {
+        decode_failure_count.fetch_add(decode_failed,
+                                       std::memory_order_relaxed);
       }
     } break;
       // 클라이언트 메시지는 파싱하여 CTI 서버에 던져준다
@@ -300,8 +125,372 @@ public:
     }
   }
 
+  /**
+   * @brief 처리하지 않은 CTI 메시지 수
+   *
+   * @return std::uint64_t
+   */
+  std::uint64_t getUnhandledMessageCount() const {
+    return unhandled_message_count.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief 디코딩에 실패해 건너뛴 CTI 메시지 수
+   *
+   * @return std::uint64_t
+   */
+  std::uint64_t getDecodeFailureCount() const {
+    return decode_failure_count.load(std::memory_order_relaxed);
+  }
+
 protected:
 private:
+  /**
+   * @brief OPEN_CONF 디코더 (로그 레벨이 꺼져 있으면 역직렬화하지 않는다)
+   *
+   * @param packet
+   * @return std::optional<cisco::session::OpenConf>
+   */
+  static std::optional<cisco::session::OpenConf>
+  decodeOpenConf(const std::span<const std::byte> packet) {
+    if (!spdlog::should_log(spdlog::level::debug)) {
+      return std::nullopt;
+    }
+
+    return cisco::common::deserialize<cisco::session::OpenConf>(packet);
+  }
+
+  /**
+   * @brief QUERY_AGENT_STATE_CONF 디코더 (로그가 꺼져 있으면 맵 갱신 필드만
+   * 읽는다)
+   *
+   * @param packet
+   * @return cisco::control::QueryAgentStateConf
+   */
+  static cisco::control::QueryAgentStateConf
+  decodeQueryAgentStateConf(const std::span<const std::byte> packet) {
+    return cisco::common::deserialize<cisco::control::QueryAgentStateConf>(
+        packet, spdlog::should_log(spdlog::level::info)
+                    ? cisco::common::DecodeMask::all()
+                    : query_agent_state_conf_mask);
+  }
+
+  /**
+   * @brief AGENT_TEAM_CONFIG_EVENT 디코더 (로그가 꺼져 있으면 맵 갱신 필드만
+   * 읽는다)
+   *
+   * @param packet
+   * @return cisco::supervisor::AgentTeamConfigEvent
+   */
+  static cisco::supervisor::AgentTeamConfigEvent
+  decodeAgentTeamConfigEvent(const std::span<const std::byte> packet) {
+    return cisco::common::deserialize<cisco::supervisor::AgentTeamConfigEvent>(
+        packet, spdlog::should_log(spdlog::level::info)
+                    ? cisco::common::DecodeMask::all()
+                    : agent_team_config_event_mask);
+  }
+
+  /**
+   * @brief SYSTEM_EVENT 디코더 (로그 레벨이 꺼져 있으면 역직렬화하지 않는다)
+   *
+   * @param packet
+   * @return std::optional<cisco::misc::SystemEvent>
+   */
+  static std::optional<cisco::misc::SystemEvent>
+  decodeSystemEvent(const std::span<const std::byte> packet) {
+    if (!spdlog::should_log(spdlog::level::info)) {
+      return std::nullopt;
+    }
+
+    return cisco::common::deserialize<cisco::misc::SystemEvent>(packet);
+  }
+
+  /**
+   * @brief OPEN_CONF 수신 (로그 전용)
+   *
+   * @param open_conf
+   */
+  void onOpenConf(const cisco::session::OpenConf &open_conf) {
+    spdlog::debug(
+        "Open conf event recieved. invoke_id: {}, service_granted: {}, "
+        "monitor_id: {}, pg_status: {}, icm_central_controller_time: {}, "
+        "peripheral_online: {}, peripheral_type: {}, agent_state: {}, "
+        "department_id: {}, session_type: {}, agent_extension: {}, "
+        "agent_id: {}, agent_instrument: {}, num_peripherals: {}, "
+        "flt_peripheral_id: {}, multiline_agent_control: {}",
+        open_conf.getInvokeID(), open_conf.getServiceGranted(),
+        open_conf.getMonitorID(), open_conf.getPGStatus(),
+        open_conf.getICMCentralControllerTime(),
+        open_conf.getPeripheralOnline(), open_conf.getPeripheralType(),
+        open_conf.getAgentState(), open_conf.getDepartmentID(),
+        open_conf.getSessionType(), open_conf.getAgentExtension(),
+        open_conf.getAgentID(), open_conf.getAgentInstrument(),
+        open_conf.getNumPeripherals(), open_conf.getFltPeripheralID(),
+        open_conf.getMultilineAgentControl());
+  }
+
+  /**
+   * @brief HEARTBEAT_CONF 수신
+   *
+   * @param heart_beat_conf
+   */
+  void onHeartbeatConf(const cisco::session::HeartbeatConf &heart_beat_conf) {
+    spdlog::debug("HEARTBEAT_CONF received. invoke_id: {}",
+                  heart_beat_conf.getInvokeID());
+  }
+
+  /**
+   * @brief AGENT_STATE_EVENT 수신 (사용하는 필드만 패킷에서 바로 읽는다)
+   *
+   * @param agent_state_event
+   * @param cti_event 수신한 세션의 묶음
+   */
+  void onAgentStateEvent(
+      const cisco::message::AgentStateEventView &agent_state_event,
+      const channel::event::CTIEvent &cti_event) {
+    spdlog::info(
+        "AGENT_STATE_EVENT received. agent_state: {}, "
+        "event_reason_code: {}, icm_agent_id: {}, agent_id: {}, "
+        "agent_extension: {}, skill_group_id: {}, "
+        "skill_Group_number: {}, state_duration: {}, direction: {}, "
+        "mrd_id: {}, peripheral_id: {}",
+        agent_state_event.getAgentState(),
+        agent_state_event.getEventReasonCode(),
+        agent_state_event.getICMAgentID(), agent_state_event.getAgentID(),
+        agent_state_event.getAgentExtension(),
+        agent_state_event.getSkillGroupID(),
+        agent_state_event.getSkillGroupNumber(),
+        agent_state_event.getStateDuration(),
+        agent_state_event.getDirection(), agent_state_event.getMRDID(),
+        agent_state_event.getPeripheralID());
+
+    // 상담원 맵에 저장 (수신한 세션의 Peripheral 별로 구분한다)
+    AgentInfoMap::getInstance()
+        ->update(AgentKey{cti_event.getPeripheralID(),
+                          agent_state_event.getAgentID()},
+                 [&](AgentInfo &agent_info) {
+                   agent_info.setPeripheralID(cti_event.getPeripheralID());
+                   agent_info.setAgentID(agent_state_event.getAgentID());
+                   agent_info.setAgentState(agent_state_event.getAgentState());
+                   agent_info.setICMAgentID(agent_state_event.getICMAgentID());
+                   agent_info.setStateDuration(
+                       agent_state_event.getStateDuration());
+                   agent_info.setDirection(agent_state_event.getDirection());
+                   agent_info.setExtension(
+                       agent_state_event.getAgentExtension());
+                   agent_info.setReasonCode(
+                       agent_state_event.getEventReasonCode());
+                   agent_info.setSkillGroupID(
+                       agent_state_event.getSkillGroupID());
+                 })
+        .broadcast();
+  }
+
+  /**
+   * @brief QUERY_AGENT_STATE_CONF 수신
+   *
+   * @param query_agent_state_conf
+   * @param cti_event 수신한 세션의 묶음
+   */
+  void onQueryAgentStateConf(
+      const cisco::control::QueryAgentStateConf &query_agent_state_conf,
+      const channel::event::CTIEvent &cti_event) {
+    spdlog::info(
+        "QUERY_AGENT_STATE_CONF received. agent_id: {}, agent_state: {}, "
+        "agent_extension: {}, skill_group_id: {}, "
+        "skill_group_number: {}, icm_agent_id: {}",
+        query_agent_state_conf.getAgentID(),
+        query_agent_state_conf.getAgentState(),
+        query_agent_state_conf.getAgentExtension(),
+        query_agent_state_conf.getSkillGroupID(),
+        query_agent_state_conf.getSkillGroupNumber(),
+        query_agent_state_conf.getICMAgentID());
+
+    // 상담원 맵에 저장 (수신한 세션의 Peripheral 별로 구분한다)
+    AgentInfoMap::getInstance()
+        ->update(
+            AgentKey{cti_event.getPeripheralID(),
+                     query_agent_state_conf.getAgentID()},
+            [&](AgentInfo &agent_info) {
+              agent_info.setPeripheralID(cti_event.getPeripheralID());
+              agent_info.setAgentID(query_agent_state_conf.getAgentID());
+              agent_info.setAgentState(query_agent_state_conf.getAgentState());
+              agent_info.setICMAgentID(query_agent_state_conf.getICMAgentID());
+              agent_info.setExtension(
+                  query_agent_state_conf.getAgentExtension());
+              agent_info.setSkillGroupID(
+                  query_agent_state_conf.getSkillGroupID());
+            })
+        .broadcast();
+  }
+
+  /**
+   * @brief AGENT_TEAM_CONFIG_EVENT 수신
+   *
+   * @param agent_team_config_event
+   * @param cti_event 수신한 세션의 묶음
+   */
+  void onAgentTeamConfigEvent(
+      const cisco::supervisor::AgentTeamConfigEvent &agent_team_config_event,
+      const channel::event::CTIEvent &cti_event) {
+    const bool log_enabled = spdlog::should_log(spdlog::level::info);
+    // 조회는 수신한 세션이 걸러 받으므로, 메시지의 Peripheral ID 가 아니라
+    // 세션의 Peripheral ID 를 쓴다
+    if (agent_team_config_event.getPeripheralID() !=
+        cti_event.getPeripheralID()) {
+      spdlog::warn("AGENT_TEAM_CONFIG_EVENT peripheral mismatch. "
+                   "event_peripheral_id: {}, session_peripheral_id: {}",
+                   agent_team_config_event.getPeripheralID(),
+                   cti_event.getPeripheralID());
+    }
+
+    // 브릿지 메시지 앞부분 (peripheralid-) 은 이벤트마다 한 번만 만든다
+    const std::string bridge_message_prefix =
+        std::to_string(cti_event.getPeripheralID()) + "-";
+
+    // 상담원 목록은 필드별 연속 배열이므로 인덱스로 순회한다
+    const cisco::supervisor::ATCAgentColumns &atc_agents =
+        agent_team_config_event.getATCAgents();
+
+    std::ostringstream atc_agent_stream;
+    for (std::size_t i = 0; i < atc_agents.size(); i++) {
+      const cisco::common::AgentIDString &atc_agent_id =
+          atc_agents.atc_agent_ids[i];
+      const std::uint16_t atc_agent_state = atc_agents.atc_agent_states[i];
+      const std::uint16_t atc_agent_state_duration =
+          atc_agents.atc_agent_state_durations[i];
+
+      if (log_enabled) {
+        atc_agent_stream << "{agent_id: " << atc_agent_id.view()
+                         << ", flag: " << atc_agents.agent_flags[i]
+                         << ", state: " << atc_agent_state
+                         << ", duration: " << atc_agent_state_duration
+                         << "}, ";
+      }
+
+      // CTI 에게 메시지 배포 (peripheralid-agentid)
+      std::vector<std::byte> bridge_message{};
+      bridge_message.reserve(bridge_message_prefix.size() +
+                             atc_agent_id.size());
+      for (const char ch : bridge_message_prefix) {
+        bridge_message.emplace_back(static_cast<std::byte>(ch));
+      }
+      for (const char ch : atc_agent_id.view()) {
+        bridge_message.emplace_back(static_cast<std::byte>(ch));
+      }
+
+      channel::EventChannel<channel::event::BridgeEvent>::getInstance()
+          ->publish(channel::event::BridgeEvent{
+              channel::event::BridgeEvent::BridgeEventDestination::CTI,
+              channel::event::BridgeEvent::BridgeEventMessage{
+                  .type = channel::event::BridgeEvent::BridgeEventType::
+                      QUERY_AGENT,
+                  .message = bridge_message}});
+
+      // 상담원 맵에 저장 (수신한 세션의 Peripheral 별로 구분한다)
+      AgentInfoMap::getInstance()
+          ->update(AgentKey{cti_event.getPeripheralID(), atc_agent_id},
+                   [&](AgentInfo &agent_info) {
+                     agent_info.setPeripheralID(cti_event.getPeripheralID());
+                     agent_info.setAgentID(atc_agent_id);
+                     agent_info.setAgentState(atc_agent_state);
+                     agent_info.setStateDuration(atc_agent_state_duration);
+                   })
+          .broadcast();
+    }
+
+    if (!log_enabled) {
+      return;
+    }
+
+    spdlog::info(
+        "AGENT_TEAM_CONF received. peripheral_id: {}, team_id: {}, "
+        "number_of_agent: {}, config_operation: {}, department_id: {}, "
+        "agent_team_name: {}, atc_agent_list: [{}]",
+        agent_team_config_event.getPeripheralID(),
+        agent_team_config_event.getTeamID(),
+        agent_team_config_event.getNumberOfAgent(),
+        agent_team_config_event.getConfigOperation(),
+        agent_team_config_event.getDepartmentID(),
+        agent_team_config_event.getAgentTeamName(), atc_agent_stream.str());
+  }
+
+  /**
+   * @brief SYSTEM_EVENT 수신 (로그 전용)
+   *
+   * @param system_event
+   */
+  void onSystemEvent(const cisco::misc::SystemEvent &system_event) {
+    spdlog::info(
+        "SYSTEM_EVENT received. pg_status: {}, "
+        "icm_central_controller_time: {}, "
+        "system_event_id: {}, system_event_arg_1: {}, "
+        "system_event_arg_2: "
+        "{}, system_event_arg_3: {}, event_device_type: {}, text: {}, "
+        "event_device_id: {}",
+        system_event.getPGStatus(),
+        system_event.getICMCentralControllerTime(),
+        system_event.getSystemEventID(), system_event.getSystemEventArg1(),
+        system_event.getSystemEventArg2(),
+        system_event.getSystemEventArg3(),
+        system_event.getEventDeviceType(), system_event.getText(),
+        system_event.getEventDeviceID());
+  }
+
+  /**
+   * @brief QUERY_AGENT_STATE_CONF 에서 상담원 맵 갱신에 필요한 필드
+   *
+   */
+  static constexpr cisco::common::DecodeMask query_agent_state_conf_mask{
+      cisco::common::MessageLayout<cisco::control::QueryAgentStateConf>::
+          maskOf<&cisco::control::QueryAgentStateConf::getAgentState,
+                 &cisco::control::QueryAgentStateConf::getICMAgentID>(),
+      cisco::common::MessageFloatingLayout<
+          cisco::control::QueryAgentStateConf>::
+          maskOf<cisco::common::TagValue::AGENT_ID_TAG,
+                 cisco::common::TagValue::AGENT_EXTENSION_TAG,
+                 cisco::common::TagValue::SKILL_GROUP_ID_TAG>()};
+
+  /**
+   * @brief AGENT_TEAM_CONFIG_EVENT 에서 상담원 맵 갱신에 필요한 필드
+   *
+   */
+  static constexpr cisco::common::DecodeMask agent_team_config_event_mask{
+      cisco::common::MessageLayout<cisco::supervisor::AgentTeamConfigEvent>::
+          maskOf<&cisco::supervisor::AgentTeamConfigEvent::getPeripheralID,
+                 &cisco::supervisor::AgentTeamConfigEvent::getNumberOfAgent>(),
+      cisco::common::MessageFloatingLayout<
+          cisco::supervisor::AgentTeamConfigEvent>::
+          maskOf<cisco::common::TagValue::ATC_AGENT_ID_TAG,
+                 cisco::common::TagValue::ATC_AGENT_STATE_TAG,
+                 cisco::common::TagValue::ATC_AGENT_STATE_DURATION_TAG>()};
+
+  /**
+   * @brief MessageType 별 디코더/핸들러 등록
+   *
+   */
+  using Dispatcher = MessageDispatcher<
+      MessageBridge, channel::event::CTIEvent,
+      MessageRoute<cisco::common::MessageType::OPEN_CONF,
+                   &MessageBridge::decodeOpenConf, &MessageBridge::onOpenConf>,
+      MessageRoute<cisco::common::MessageType::HEARTBEAT_CONF,
+                   &decodeMessage<cisco::session::HeartbeatConf>,
+                   &MessageBridge::onHeartbeatConf>,
+      MessageRoute<cisco::common::MessageType::AGENT_STATE_EVENT,
+                   &decodeMessage<cisco::message::AgentStateEventView>,
+                   &MessageBridge::onAgentStateEvent>,
+      MessageRoute<cisco::common::MessageType::QUERY_AGENT_STATE_CONF,
+                   &MessageBridge::decodeQueryAgentStateConf,
+                   &MessageBridge::onQueryAgentStateConf>,
+      MessageRoute<cisco::common::MessageType::AGENT_TEAM_CONFIG_EVENT,
+                   &MessageBridge::decodeAgentTeamConfigEvent,
+                   &MessageBridge::onAgentTeamConfigEvent>,
+      MessageRoute<cisco::common::MessageType::SYSTEM_EVENT,
+                   &MessageBridge::decodeSystemEvent,
+                   &MessageBridge::onSystemEvent>>;
+
+  std::atomic_uint64_t unhandled_message_count{0};
+  std::atomic_uint64_t decode_failure_count{0};
 }; // namespace ctm::bridge
 } // namespace ctm::bridge
 
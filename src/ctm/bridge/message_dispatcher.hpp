@@ -0,0 +1,175 @@
+#pragma once
+
+#ifndef _CTM_CTM_BRIDGE_MESSAGE_DISPATCHER_HPP_
+#define _CTM_CTM_BRIDGE_MESSAGE_DISPATCHER_HPP_
+
+/*
+  MessageType 디스패치 테이블
+  +-------------+---------+---------+
+  | MessageType | Decoder | Handler |
+  +-------------+---------+---------+
+  MessageType 값을 인덱스로 하는 테이블을 컴파일 타임에 생성하고, 수신한 패킷을
+  등록된 디코더로 역직렬화한 뒤 핸들러에 넘긴다. 핸들러가 받으면 패킷이 속한
+  묶음(Context)도 함께 넘긴다.
+  등록되지 않은 MessageType 은 테이블 조회 한 번으로 끝난다.
+*/
+
+#include "../../cisco/common/message_type.hpp"
+#include "../../cisco/common/serializable.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <optional>
+#include <span>
+#include <type_traits>
+
+namespace ctm::bridge {
+
+namespace detail {
+template <typename T> struct IsOptional : std::false_type {};
+template <typename T> struct IsOptional<std::optional<T>> : std::true_type {};
+} // namespace detail
+
+/**
+ * @brief 기본 디코더 (패킷 뷰는 직접 생성하고, 그 외는 역직렬화한다)
+ *
+ * @tparam T
+ * @param packet
+ * @return T
+ */
+template <typename T>
+inline T decodeMessage(const std::span<const std::byte> packet) {
+  if constexpr (std::is_constructible_v<T, std::span<const std::byte>>) {
+    return T{packet};
+  } else {
+    return cisco::common::deserialize<T>(packet);
+  }
+}
+
+/**
+ * @brief MessageType 별 디코더/핸들러 쌍
+ *
+ * Decoder 가 std::optional 을 반환하고 값이 없으면 핸들러를 호출하지 않는다.
+ *
+ * @tparam Type
+ * @tparam Decoder T (*)(std::span<const std::byte>)
+ * @tparam Handler void (Owner::*)(const T &) 또는
+ * void (Owner::*)(const T &, const Context &)
+ */
+template <cisco::common::MessageType Type, auto Decoder, auto Handler>
+struct MessageRoute {
+  static constexpr cisco::common::MessageType type = Type;
+
+  /**
+   * @brief 패킷을 디코딩해 핸들러 호출
+   *
+   * @tparam Owner
+   * @tparam Context
+   * @param owner
+   * @param packet
+   * @param context 패킷이 속한 묶음
+   */
+  template <typename Owner, typename Context>
+  static void invoke(Owner &owner, const std::span<const std::byte> packet,
+                     const Context &context) {
+    using decoded_type = std::invoke_result_t<decltype(Decoder),
+                                              std::span<const std::byte>>;
+
+    if constexpr (detail::IsOptional<decoded_type>::value) {
+      const decoded_type message = Decoder(packet);
+      if (message.has_value()) {
+        handle(owner, message.value(), context);
+      }
+    } else {
+      handle(owner, Decoder(packet), context);
+    }
+  }
+
+  /**
+   * @brief 핸들러 호출 (묶음을 받지 않는 핸들러에는 메시지만 넘긴다)
+   *
+   * @tparam Owner
+   * @tparam Message
+   * @tparam Context
+   * @param owner
+   * @param message
+   * @param context
+   */
+  template <typename Owner, typename Message, typename Context>
+  static void handle(Owner &owner, const Message &message,
+                     const Context &context) {
+    if constexpr (std::is_invocable_v<decltype(Handler), Owner &,
+                                      const Message &, const Context &>) {
+      (owner.*Handler)(message, context);
+    } else {
+      (owner.*Handler)(message);
+    }
+  }
+};
+
+/**
+ * @brief MessageType 디스패처
+ *
+ * @tparam Owner 핸들러 멤버 함수를 가진 클래스
+ * @tparam Context 패킷이 속한 묶음
+ * @tparam Routes
+ */
+template <typename Owner, typename Context, typename... Routes>
+struct MessageDispatcher {
+  using Handler = void (*)(Owner &, const std::span<const std::byte>,
+                           const Context &);
+
+  /**
+   * @brief MessageType 값으로 인덱싱하는 핸들러 테이블
+   *
+   */
+  static constexpr auto handlers = [] {
+    constexpr std::size_t table_size =
+        std::max({std::size_t{0},
+                  static_cast<std::size_t>(Routes::type) + 1 ...});
+
+    std::array<Handler, table_size> result{};
+    ((result[static_cast<std::size_t>(Routes::type)] =
+          &Routes::template invoke<Owner, Context>),
+     ...);
+
+    return result;
+  }();
+
+  static_assert(
+      [] {
+        std::size_t registered = 0;
+        for (const Handler handler : handlers) {
+          registered += handler != nullptr ? 1 : 0;
+        }
+
+        return registered == sizeof...(Routes);
+      }(),
+      "Duplicated MessageType in dispatcher");
+
+  /**
+   * @brief 등록된 핸들러로 패킷을 전달
+   *
+   * @param owner
+   * @param type
+   * @param packet
+   * @param context
+   * @return true 처리됨
+   * @return false 등록되지 않은 MessageType
+   */
+  static bool dispatch(Owner &owner, const cisco::common::MessageType type,
+                       const std::span<const std::byte> packet,
+                       const Context &context) {
+    const std::size_t index = static_cast<std::size_t>(type);
+    if (index >= handlers.size() || handlers[index] == nullptr) {
+      return false;
+    }
+
+    handlers[index](owner, packet, context);
+    return true;
+  }
+};
+} // namespace ctm::bridge
+
+#endif
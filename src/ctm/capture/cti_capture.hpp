@@ -0,0 +1,222 @@
+#pragma once
+
+#ifndef _CTM_CTM_CAPTURE_CTI_CAPTURE_HPP_
+#define _CTM_CTM_CAPTURE_CTI_CAPTURE_HPP_
+
+/*
+  CTI 수신 캡처 파일
+  +--------+---------+-----------+--------+--------+-----+
+  | Magic  | Version | Timestamp | Length | Frames | ... |
+  +--------+---------+-----------+--------+--------+-----+
+  | 6      | 2       | 8         | 4      | Length |     |
+  +--------+---------+-----------+--------+--------+-----+
+  파일 헤더 뒤에 수신 단위 레코드가 이어진다. Timestamp 는 캡처 시작부터의
+  단조 시간(나노초)이고, Frames 는 한 번의 수신으로 완성된 MHDR 프레임들을
+  그대로 이어 붙인 것이다. 정수는 모두 빅 엔디안이다.
+*/
+
+#include "../../cisco/common/field_layout.hpp"
+#include "../../cisco/common/frame_assembler.hpp"
+#include "../../cisco/common/mhdr.hpp"
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace ctm::capture {
+/**
+ * @brief 파일 식별자
+ *
+ */
+inline constexpr std::string_view capture_magic{"CTMCAP"};
+/**
+ * @brief 파일 형식 버전
+ *
+ */
+inline constexpr std::uint16_t capture_version = 1;
+/**
+ * @brief 파일 헤더 길이
+ *
+ */
+inline constexpr std::size_t capture_header_size = 8;
+/**
+ * @brief 레코드 헤더 길이 (Timestamp + Length)
+ *
+ */
+inline constexpr std::size_t record_header_size = 12;
+
+/**
+ * @brief 수신 프레임 캡처 기록기
+ *
+ * 수신 스레드 하나에서만 호출한다.
+ */
+class CaptureWriter {
+public:
+  /**
+   * @brief Construct a new Capture Writer object
+   *
+   * @param path
+   */
+  explicit CaptureWriter(const std::filesystem::path &path)
+      : output{path, std::ios::binary | std::ios::trunc},
+        begin{std::chrono::steady_clock::now()} {
+    std::array<std::byte, capture_header_size> header{};
+    std::memcpy(header.data(), capture_magic.data(), capture_magic.size());
+    cisco::common::detail::store(header.data() + capture_magic.size(),
+                                 capture_version);
+
+    output.write(reinterpret_cast<const char *>(header.data()),
+                 header.size());
+  }
+
+  CaptureWriter(const CaptureWriter &) = delete;
+  CaptureWriter &operator=(const CaptureWriter &) = delete;
+
+  /**
+   * @brief Destroy the Capture Writer object
+   *
+   */
+  ~CaptureWriter() { output.flush(); }
+
+  /**
+   * @brief 파일이 정상적으로 열렸는지 판단
+   *
+   * @return true
+   * @return false
+   */
+  bool isOpen() const { return output.is_open() && output.good(); }
+
+  /**
+   * @brief 한 번의 수신으로 완성된 프레임들을 기록
+   *
+   * @param frames
+   */
+  void write(const std::span<const std::byte> frames) {
+    const std::uint64_t timestamp = static_cast<std::uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - begin)
+            .count());
+
+    std::array<std::byte, record_header_size> header{};
+    cisco::common::detail::store(header.data(), timestamp);
+    cisco::common::detail::store(header.data() + 8,
+                                 static_cast<std::uint32_t>(frames.size()));
+
+    output.write(reinterpret_cast<const char *>(header.data()), header.size());
+    output.write(reinterpret_cast<const char *>(frames.data()),
+                 static_cast<std::streamsize>(frames.size()));
+  }
+
+protected:
+private:
+  std::ofstream output;
+  std::chrono::steady_clock::time_point begin;
+};
+
+/**
+ * @brief 캡처 파일 순차 읽기
+ *
+ */
+class CaptureReader {
+public:
+  /**
+   * @brief Construct a new Capture Reader object
+   *
+   * @param path
+   */
+  explicit CaptureReader(const std::filesystem::path &path)
+      : input{path, std::ios::binary} {
+    std::array<std::byte, capture_header_size> header{};
+    input.read(reinterpret_cast<char *>(header.data()), header.size());
+
+    valid = input.good() &&
+            std::memcmp(header.data(), capture_magic.data(),
+                        capture_magic.size()) == 0 &&
+            cisco::common::detail::load<std::uint16_t>(
+                header.data() + capture_magic.size()) == capture_version;
+  }
+
+  /**
+   * @brief Destroy the Capture Reader object
+   *
+   */
+  ~CaptureReader() = default;
+
+  /**
+   * @brief 읽을 수 있는 캡처 파일인지 판단
+   *
+   * @return true
+   * @return false
+   */
+  bool isValid() const { return valid; }
+
+  /**
+   * @brief 다음 레코드를 읽는다
+   *
+   * @param timestamp 캡처 시작부터의 시간 (나노초)
+   * @param frames 레코드의 프레임들 (재사용 버퍼)
+   * @param boundaries frames 기준 프레임 경계 (재사용 버퍼)
+   * @return true
+   * @return false 파일 끝이거나 레코드가 손상된 경우
+   */
+  bool next(std::uint64_t &timestamp, std::vector<std::byte> &frames,
+            std::vector<cisco::common::FrameBoundary> &boundaries) {
+    if (!valid) {
+      return false;
+    }
+
+    std::array<std::byte, record_header_size> header{};
+    input.read(reinterpret_cast<char *>(header.data()), header.size());
+    if (!input.good()) {
+      return false;
+    }
+
+    timestamp = cisco::common::detail::load<std::uint64_t>(header.data());
+    frames.resize(cisco::common::detail::load<std::uint32_t>(
+        header.data() + 8));
+    input.read(reinterpret_cast<char *>(frames.data()),
+               static_cast<std::streamsize>(frames.size()));
+    if (!input.good()) {
+      return false;
+    }
+
+    // 레코드 안의 프레임 경계는 MHDR 길이로 다시 구한다
+    boundaries.clear();
+    for (std::size_t offset = 0; offset < frames.size();) {
+      if (frames.size() - offset < cisco::common::field_size_v<
+                                       cisco::common::MHDR>) {
+        valid = false;
+        return false;
+      }
+
+      const std::size_t length =
+          cisco::common::detail::load<std::uint32_t>(frames.data() + offset) +
+          cisco::common::field_size_v<cisco::common::MHDR>;
+      if (length > frames.size() - offset) {
+        valid = false;
+        return false;
+      }
+
+      boundaries.emplace_back(cisco::common::FrameBoundary{offset, length});
+      offset += length;
+    }
+
+    return true;
+  }
+
+protected:
+private:
+  std::ifstream input;
+  bool valid{false};
+};
+} // namespace ctm::capture
+
+#endif
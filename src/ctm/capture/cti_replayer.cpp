@@ -0,0 +1,144 @@
+#include "./cti_replayer.h"
+#include "../../channel/event/cti_event.hpp"
+#include "../../channel/event/cti_read_batch.hpp"
+#include "../../channel/event_channel.hpp"
+#include "./cti_capture.hpp"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+namespace ctm::capture {
+/**
+ * @brief Construct a new CTIReplayer::CTIReplayer object
+ *
+ * @param path
+ * @param speed
+ * @param peripheral_id
+ */
+CTIReplayer::CTIReplayer(const filesystem::path &path, const double speed,
+                         const uint32_t peripheral_id)
+    : path{path}, speed{speed}, peripheral_id{peripheral_id} {
+  spdlog::info(
+      "CTIReplayer constructed. path: {}, speed: {}, peripheral_id: {}",
+      path.string(), speed, peripheral_id);
+}
+
+/**
+ * @brief Destroy the CTIReplayer::CTIReplayer object
+ *
+ */
+CTIReplayer::~CTIReplayer() {
+  stop();
+  if (replay_thread.joinable()) {
+    replay_thread.join();
+  }
+}
+
+/**
+ * @brief 재생 시작
+ *
+ */
+void CTIReplayer::start() {
+  if (running.exchange(true, memory_order::acq_rel)) {
+    return;
+  }
+
+  replay_thread = thread{&CTIReplayer::replay, this};
+}
+
+/**
+ * @brief 재생 중단
+ *
+ */
+void CTIReplayer::stop() noexcept {
+  running.store(false, memory_order::release);
+}
+
+/**
+ * @brief 재생 스레드 본문
+ *
+ */
+void CTIReplayer::replay() {
+  CaptureReader reader{path};
+  if (!reader.isValid()) {
+    spdlog::error("Invalid CTI capture file. path: {}", path.string());
+    running.store(false, memory_order::release);
+    return;
+  }
+
+  uint64_t timestamp{0};
+  vector<byte> frames{};
+  vector<cisco::common::FrameBoundary> boundaries{};
+
+  // 재생 통계 (초 단위 구간별 프레임 수로 최대 처리율을 구한다)
+  size_t frame_count{0};
+  size_t batch_count{0};
+  size_t second_frame_count{0};
+  size_t peak_frames_per_second{0};
+
+  const chrono::steady_clock::time_point replay_begin =
+      chrono::steady_clock::now();
+  chrono::steady_clock::time_point second_begin = replay_begin;
+  optional<uint64_t> first_timestamp{};
+
+  while (running.load(memory_order::acquire) &&
+         reader.next(timestamp, frames, boundaries)) {
+    if (!first_timestamp.has_value()) {
+      first_timestamp = timestamp;
+    }
+
+    // 캡처 당시의 수신 간격을 배속에 맞춰 재현한다
+    if (speed > 0) {
+      this_thread::sleep_until(
+          replay_begin +
+          chrono::duration_cast<chrono::steady_clock::duration>(
+              chrono::duration<double, nano>{
+                  static_cast<double>(timestamp - *first_timestamp) / speed}));
+    }
+
+    if (boundaries.empty()) {
+      continue;
+    }
+
+    channel::EventChannel<channel::event::CTIEvent>::getInstance()->publish(
+        channel::event::CTIEvent{
+            make_shared<const channel::event::CTIReadBatch>(frames, boundaries),
+            peripheral_id});
+
+    batch_count++;
+    frame_count += boundaries.size();
+
+    const chrono::steady_clock::time_point now = chrono::steady_clock::now();
+    if (now - second_begin >= chrono::seconds{1}) {
+      peak_frames_per_second =
+          max(peak_frames_per_second, second_frame_count);
+      second_begin = now;
+      second_frame_count = 0;
+    }
+    second_frame_count += boundaries.size();
+  }
+
+  const chrono::duration<double> elapsed =
+      chrono::steady_clock::now() - replay_begin;
+  peak_frames_per_second = max(peak_frames_per_second, second_frame_count);
+
+  spdlog::info("CTI capture replayed. path: {}, speed: {}, batches: {}, "
+               "frames: {}, elapsed: {:.3f}s, frames_per_second: {:.0f}, "
+               "peak_frames_per_second: {}",
+               path.string(), speed, batch_count, frame_count, elapsed.count(),
+               elapsed.count() > 0 ? frame_count / elapsed.count() : 0.0,
+               peak_frames_per_second);
+
+  running.store(false, memory_order::release);
+}
+} // namespace ctm::capture
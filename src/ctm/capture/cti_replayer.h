@@ -0,0 +1,67 @@
+#pragma once
+
+#ifndef _CTM_CTM_CAPTURE_CTI_REPLAYER_H_
+#define _CTM_CTM_CAPTURE_CTI_REPLAYER_H_
+
+#include <atomic>
+#include <cstdint>
+#include <filesystem>
+#include <thread>
+
+namespace ctm::capture {
+/**
+ * @brief 캡처 파일 재생기
+ *
+ * 라이브 CG 대신 캡처 파일의 수신 단위 레코드를 CTIEvent 채널로 배포한다.
+ * 레코드 하나가 CTIEvent 하나가 되므로, 수신 당시의 배치 모양이 그대로
+ * 재현된다.
+ */
+class CTIReplayer {
+public:
+  /**
+   * @brief Construct a new CTIReplayer object
+   *
+   * @param path 캡처 파일 경로
+   * @param speed 재생 배속 (0 이하면 대기 없이 최대 속도)
+   * @param peripheral_id 재생한 배치를 수신한 것으로 볼 Peripheral ID
+   */
+  CTIReplayer(const std::filesystem::path &path, const double speed,
+              const std::uint32_t peripheral_id);
+  /**
+   * @brief Destroy the CTIReplayer object
+   *
+   */
+  virtual ~CTIReplayer();
+
+  const CTIReplayer &operator=(const CTIReplayer &) = delete;
+  CTIReplayer(const CTIReplayer &) = delete;
+
+  /**
+   * @brief 재생 시작
+   *
+   */
+  void start();
+  /**
+   * @brief 재생 중단
+   *
+   */
+  void stop() noexcept;
+
+protected:
+private:
+  /**
+   * @brief 재생 스레드 본문
+   *
+   */
+  void replay();
+
+  std::filesystem::path path;
+  double speed;
+  std::uint32_t peripheral_id;
+
+  std::atomic_bool running{false};
+  std::thread replay_thread;
+};
+} // namespace ctm::capture
+
+#endif
@@ -0,0 +1,98 @@
+#pragma once
+
+#ifndef _CTM_CTM_CLIENT_RETIRER_HPP_
+#define _CTM_CTM_CLIENT_RETIRER_HPP_
+
+/*
+  CTI Client 정리 스레드
+  이벤트 채널 스레드     --+  retire()   +---------+
+  재접속 스케줄러 스레드 --+-----------> | retired | --> 정리 스레드 (~CTIClient)
+                                         +---------+
+  ~CTIClient 는 I/O 루프가 남은 작업을 마칠 때까지 기다린다. 루프는
+  CTIErrorEvent 를 발행하며 이벤트 채널 잠금을 기다릴 수 있으므로, 채널
+  스레드나 세션 잠금을 잡은 스레드에서 소멸시키면 서로 기다리게 된다.
+*/
+
+#include "./cti_client.h"
+
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace ctm {
+class ClientRetirer {
+public:
+  /**
+   * @brief Construct a new Client Retirer object (정리 스레드를 바로 시작한다)
+   *
+   */
+  ClientRetirer() : worker{[this]() { run(); }} {}
+
+  /**
+   * @brief Destroy the Client Retirer object (남은 세션을 모두 정리한다)
+   *
+   */
+  ~ClientRetirer() {
+    {
+      std::lock_guard<std::mutex> lock{mutex};
+      is_stopped = true;
+    }
+    condition.notify_all();
+    worker.join();
+  }
+
+  ClientRetirer(const ClientRetirer &) = delete;
+  ClientRetirer &operator=(const ClientRetirer &) = delete;
+
+  /**
+   * @brief 세션을 정리 스레드로 넘긴다 (모든 스레드, 바로 반환)
+   *
+   * @param client
+   */
+  void retire(std::unique_ptr<CTIClient> client) {
+    if (!client) {
+      return;
+    }
+
+    {
+      std::lock_guard<std::mutex> lock{mutex};
+      retired.emplace_back(std::move(client));
+    }
+    condition.notify_all();
+  }
+
+protected:
+private:
+  /**
+   * @brief 정리 스레드 (잠금을 풀고 소멸시킨다)
+   *
+   */
+  void run() {
+    std::unique_lock<std::mutex> lock{mutex};
+    while (true) {
+      condition.wait(lock, [this]() { return is_stopped || !retired.empty(); });
+      if (retired.empty()) {
+        return;
+      }
+
+      std::vector<std::unique_ptr<CTIClient>> clients = std::move(retired);
+      retired.clear();
+      lock.unlock();
+      clients.clear();
+      lock.lock();
+    }
+  }
+
+  std::mutex mutex{};
+  std::condition_variable condition{};
+  std::vector<std::unique_ptr<CTIClient>> retired{};
+  bool is_stopped{false};
+
+  std::thread worker;
+};
+} // namespace ctm
+
+#endif
@@ -7,6 +7,7 @@
 
 #include <atomic>
 #include <cstdint>
+#include <limits>
 
 namespace ctm {
 class ClientState : public tmpl::Singleton<ClientState> {
@@ -52,11 +53,14 @@ class ClientState : public tmpl::Singleton<ClientState> {
     }
 
     /**
-     * @brief 재시도 횟수 누산
+     * @brief 재시도 횟수 누산 (최대값에서 멈춘다)
      *
      */
     void addRetryCount() {
-        std::int8_t current = getRetryCount();
+        std::uint8_t current = getRetryCount();
+        if (current == std::numeric_limits<std::uint8_t>::max()) {
+            return;
+        }
         this->retry_count.store(current + 1, std::memory_order_release);
     }
 
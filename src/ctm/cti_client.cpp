@@ -2,27 +2,46 @@
 #include "../channel/event/bridge_event.hpp"
 #include "../channel/event/cti_error_event.hpp"
 #include "../channel/event/cti_event.hpp"
+#include "../channel/event/cti_read_batch.hpp"
 #include "../channel/event/event.hpp"
 #include "../channel/event_channel.hpp"
+#include "../cisco/common/field_layout.hpp"
+#include "../cisco/common/message_type.hpp"
+#include "../cisco/common/request_template.hpp"
 #include "../cisco/control/query_agent_state_req.hpp"
 #include "../cisco/session/heartbeat_req.hpp"
 #include "../cisco/session/open_req.hpp"
 #include "../util/ini_loader.h"
-#include "./client_state.hpp"
-
-#include <Poco/AutoPtr.h>
-#include <Poco/NObserver.h>
-#include <Poco/Net/SocketAddress.h>
-#include <Poco/Net/SocketNotification.h>
+#include "./io_loop.hpp"
+
+#include <asio/buffer.hpp>
+#include <asio/co_spawn.hpp>
+#include <asio/error.hpp>
+#include <asio/error_code.hpp>
+#include <asio/post.hpp>
+#include <asio/redirect_error.hpp>
+#include <asio/socket_base.hpp>
+#include <asio/system_error.hpp>
+#include <asio/use_awaitable.hpp>
+#include <asio/use_future.hpp>
 #include <spdlog/spdlog.h>
 
 #include <atomic>
 #include <chrono>
+#include <ctime>
+#include <exception>
+#include <filesystem>
+#include <functional>
+#include <future>
 #include <iomanip>
 #include <ios>
+#include <memory>
+#include <optional>
 #include <regex>
+#include <stdexcept>
+#include <span>
 #include <sstream>
-#include <thread>
+#include <utility>
 #include <vector>
 
 using namespace std;
@@ -32,37 +51,89 @@ namespace ctm {
 /**
  * @brief Construct a new CTIClient::CTIClient object
  *
+ * @param config
+ * @param is_side_a
+ * @param is_standby
+ * @param cti_event_worker
  */
-CTIClient::CTIClient() {
-  const ClientState *client_state = ClientState::getInstance();
-  const util::IniLoader *ini_loader = util::IniLoader::getInstance();
-
+CTIClient::CTIClient(const CTISessionConfig &config, const bool is_side_a,
+                     const bool is_standby,
+                     EventWorker<event::CTIEvent> *cti_event_worker)
+    : io_context{IOLoop::getInstance()->getContext(config.loop_index)},
+      client_socket{io_context}, write_signal{io_context},
+      tick_timer{io_context}, session_name{config.name},
+      peripheral_id{config.peripheral_id}, is_side_a{is_side_a},
+      is_standby{is_standby}, cti_event_worker{cti_event_worker} {
   // TLS 프로토콜 사용 여부
-  bool is_secured = ini_loader->get("cti", "protocol.secure", false);
+  bool is_secured = config.get("protocol.secure", false);
 
-  // Active/Standby Plain/Secure 구분
-  string ip_key = client_state->isActive() ? "side.a.ip" : "side.b.ip";
-  string port_key = client_state->isActive() ? is_secured ? "side.a.port.secure"
-                                                          : "side.a.port.plain"
-                    : is_secured             ? "side.b.port.secure"
-                                             : "side.b.port.plain";
+  // Side A/B Plain/Secure 구분
+  string ip_key = is_side_a ? "side.a.ip" : "side.b.ip";
+  string port_key = is_side_a    ? is_secured ? "side.a.port.secure"
+                                              : "side.a.port.plain"
+                    : is_secured ? "side.b.port.secure"
+                                 : "side.b.port.plain";
 
   // CG 접속정보 저장 (기본값: localhost:42027)
+  this->cti_server_ip = config.get(ip_key, "localhost"s);
+  this->cti_server_port = static_cast<uint16_t>(config.get(port_key, 42027));
   stringstream ss{};
-  ss << ini_loader->get("cti", ip_key, "localhost"s) << ":"
-     << ini_loader->get("cti", port_key, 42027);
+  ss << cti_server_ip << ":" << cti_server_port;
   this->cti_server_host = ss.str();
 
   // Timeout 설정
-  this->connection_timespan =
-      ini_loader->get("cti", "timeout.connection", 5'000) * 1'000;
-  this->heartbeat_timespan =
-      ini_loader->get("cti", "timeout.heartbeat", 5'000) * 1'000;
-  client_socket_reactor.setTimeout(connection_timespan);
+  this->connection_timeout =
+      chrono::milliseconds{config.get("timeout.connection", 5'000)};
+  this->heartbeat_interval =
+      chrono::milliseconds{config.get("timeout.heartbeat", 5'000)};
+
+  // 하트비트는 주기 작업 코루틴에서 보내므로, 주기가 송신 시각의 오차가 된다
+  this->heartbeat_monitor = HeartbeatMonitor{
+      heartbeat_interval,
+      static_cast<size_t>(config.get("heartbeat.missed.max", 3))};
+  write_signal.expires_at(chrono::steady_clock::time_point::max());
+
+  // 응답이 없는 요청은 기한마다 재전송하고, 그래도 없으면 포기한다
+  request_table.configure(
+      chrono::milliseconds{config.get("timeout.request", 5'000)},
+      static_cast<uint32_t>(config.get("request.retry.max", 2)));
+
+  // 팀 구성 이벤트로 몰려드는 상담원 조회는 속도와 동시 요청 수를 제한한다
+  query_pacer.configure(
+      config.get("query.rate", 200.0), config.get("query.burst", 50.0),
+      static_cast<size_t>(config.get("query.inflight.max", 100)));
+
+  // 수신 프레임 캡처 (재접속마다 새 파일을 만든다, 대기 세션은 배포하지
+  // 않으므로 캡처하지 않는다)
+  if (!is_standby && config.get("capture.enabled", false)) {
+    const time_t now = chrono::system_clock::to_time_t(
+        chrono::system_clock::now());
+    stringstream file_name{};
+    file_name << "cti-" << session_name << "-" << (is_side_a ? "a" : "b")
+              << "-" << put_time(localtime(&now), "%Y%m%d-%H%M%S") << ".cap";
+
+    const filesystem::path capture_dir =
+        config.get("capture.dir", "./capture"s);
+    error_code error{};
+    filesystem::create_directories(capture_dir, error);
+
+    capture_writer = make_unique<capture::CaptureWriter>(capture_dir /
+                                                         file_name.str());
+    if (capture_writer->isOpen()) {
+      spdlog::info("CTI capture enabled. path: {}",
+                   (capture_dir / file_name.str()).string());
+    } else {
+      spdlog::error("Unable to open CTI capture file. path: {}",
+                    (capture_dir / file_name.str()).string());
+      capture_writer.reset();
+    }
+  }
 
   EventChannel<event::BridgeEvent>::getInstance()->subscribe(this);
 
-  spdlog::info("CTIClient constructed. cti_server_host: {}", cti_server_host);
+  spdlog::info("CTIClient constructed. session: {}, cti_server_host: {}, "
+               "peripheral_id: {}, standby: {}",
+               session_name, cti_server_host, peripheral_id, is_standby);
 }
 
 /**
@@ -71,8 +142,15 @@ CTIClient::CTIClient() {
  */
 CTIClient::~CTIClient() {
   EventChannel<event::BridgeEvent>::getInstance()->unsubscribe(this);
-  client_socket_reactor.stop();
-  reactor_thread.join();
+
+  // 루프에 남은 코루틴과 작업이 모두 끝나야 멤버를 해제할 수 있다
+  post([this]() {
+    current_state.store(FiniteState::FINISHED, memory_order::release);
+    closeSocket();
+  });
+
+  unique_lock<mutex> lock{loop_work_mutex};
+  loop_work_condition.wait(lock, [this]() { return loop_work_count == 0; });
 }
 
 /**
@@ -81,201 +159,750 @@ CTIClient::~CTIClient() {
  */
 void CTIClient::connect() noexcept {
   // 초기화 상태가 아니라면 접속 시도하지 않는다
-  if (getCurrentState() != FiniteState::INITIALIZED) {
+  FiniteState expected = FiniteState::INITIALIZED;
+  if (!current_state.compare_exchange_strong(expected,
+                                             FiniteState::CONNECTING)) {
     return;
   }
 
-  // 접속 시도하고 현재 FSM 값을 변경
+  // 접속과 세션 시작은 루프 스레드에서 하고, 호출한 스레드는 결과만 기다린다
   try {
-    client_socket.connect(Poco::Net::SocketAddress{cti_server_host},
-                          connection_timespan);
+    asio::co_spawn(io_context, open(), asio::use_future).get();
   } catch (const exception &e) {
+    current_state.store(FiniteState::INITIALIZED, memory_order::release);
     spdlog::error(
         "Unabled to connect CTI Server. cti_server_host: {}, reason: {}",
         getCTIServerHost(), e.what());
     EventChannel<event::CTIErrorEvent>::getInstance()->publish(
         event::CTIErrorEvent{
-            getCTIServerHost(),
+            session_name, getCTIServerHost(),
             event::CTIErrorEvent::CTIErrorType::CONNECTION_FAIL});
     return;
   }
+}
+
+/**
+ * @brief CTI 서버 접속 해제
+ *
+ */
+void CTIClient::disconnect() noexcept {
+  spdlog::info("CTI Server disconnected. cti_server_host: {}", cti_server_host);
+  current_state.store(FiniteState::FINISHED, memory_order::release);
+  post([this]() { closeSocket(); });
+}
 
-  // 소켓 옵션 설정
-  client_socket.setBlocking(false);
-  client_socket.setSendTimeout(heartbeat_timespan);
-  client_socket.setReceiveTimeout(heartbeat_timespan);
-  current_state.store(FiniteState::CONNECTING, memory_order::release);
-
-  // Reactor 콜백 등록
-  client_socket_reactor.addEventHandler(
-      client_socket,
-      Poco::NObserver<CTIClient, Poco::Net::ReadableNotification>{
-          *this, &CTIClient::onReadableNotification});
-  client_socket_reactor.addEventHandler(
-      client_socket, Poco::NObserver<CTIClient, Poco::Net::ErrorNotification>{
-                         *this, &CTIClient::onErrorNotification});
-  client_socket_reactor.addEventHandler(
-      client_socket,
-      Poco::NObserver<CTIClient, Poco::Net::ShutdownNotification>{
-          *this, &CTIClient::onShutdownNotification});
-
-  // Poco 스레드를 사용해 처리해야 예외가 발생하지 않는다.
-  reactor_thread.start(client_socket_reactor);
-
-  // 접속 중 플래그 변경
+/**
+ * @brief 접속하고 세션 코루틴들을 시작한다
+ *
+ * @return asio::awaitable<void>
+ */
+asio::awaitable<void> CTIClient::open() {
+  // 접속 시간 제한은 주소 조회부터 접속 완료까지를 잰다. 만료되면 조회를
+  // 취소하고 소켓을 닫아 진행 중인 작업을 중단시킨다. 만료 처리가 접속
+  // 완료와 같은 때에 큐에 들어가 open() 이 끝난 뒤 실행될 수 있으므로,
+  // 리졸버와 상태는 코루틴 지역 변수 대신 공유 상태에 두고, 접속이 끝났으면
+  // 소켓을 건드리지 않는다
+  struct ConnectAttempt {
+    explicit ConnectAttempt(asio::io_context &io_context)
+        : resolver{io_context} {}
+
+    asio::ip::tcp::resolver resolver;
+    bool is_finished{false};
+    bool is_timed_out{false};
+  };
+  const shared_ptr<ConnectAttempt> attempt =
+      make_shared<ConnectAttempt>(io_context);
+  asio::steady_timer connection_timer{io_context, connection_timeout};
+  connection_timer.async_wait([this, attempt](const asio::error_code &error) {
+    if (error || attempt->is_finished) {
+      return;
+    }
+    attempt->is_timed_out = true;
+    attempt->resolver.cancel();
+    asio::error_code close_error{};
+    client_socket.close(close_error);
+  });
+
+  asio::error_code error{};
+  const asio::ip::tcp::resolver::results_type endpoints =
+      co_await attempt->resolver.async_resolve(
+          cti_server_ip, to_string(cti_server_port),
+          asio::redirect_error(asio::use_awaitable, error));
+  if (error) {
+    attempt->is_finished = true;
+    connection_timer.cancel();
+    if (attempt->is_timed_out) {
+      throw asio::system_error{asio::error::timed_out};
+    }
+    throw asio::system_error{error};
+  }
+
+  // 주소가 여럿이면 차례로 시도하되, 시간이 다 되면 다음 주소로 넘어가지
+  // 않는다 (범위 async_connect 는 닫힌 소켓을 다시 열어 계속 시도한다)
+  error = asio::error::host_not_found;
+  for (const asio::ip::tcp::resolver::results_type::value_type &entry :
+       endpoints) {
+    if (attempt->is_timed_out) {
+      break;
+    }
+
+    asio::error_code close_error{};
+    client_socket.close(close_error);
+    co_await client_socket.async_connect(
+        entry.endpoint(), asio::redirect_error(asio::use_awaitable, error));
+    if (!error) {
+      break;
+    }
+  }
+  attempt->is_finished = true;
+  connection_timer.cancel();
+
+  if (attempt->is_timed_out) {
+    throw asio::system_error{asio::error::timed_out};
+  }
+  if (error) {
+    throw asio::system_error{error};
+  }
+
+  // 이전 연결에서 남은 미완성 프레임과 보내지 못한 요청은 버린다
+  frame_assembler.reset();
+  send_queue.reset();
+  request_table.clear();
+  query_pacer.reset();
+  had_request_burst = false;
+  heartbeat_monitor.reset(HeartbeatMonitor::clock::now());
+  is_write_requested = false;
+
+  // 소켓 옵션 설정 (송신은 논블로킹으로 바로 시도하고, 막히면 기다린다)
+  client_socket.set_option(asio::ip::tcp::no_delay{true});
+  client_socket.set_option(asio::socket_base::linger{true, 3});
+  client_socket.non_blocking(true);
   current_state.store(FiniteState::CONNECTED, memory_order::release);
   spdlog::info("CTI Server connected. cti_server_host: {}", cti_server_host);
 
-  // 소켓 옵션 설정
-  client_socket.setLinger(true, 3);
-  client_socket.setNoDelay(true);
+  spawn(reader());
+  spawn(writer());
+  spawn(ticker());
 
   // OPEN_REQ 메시지 전송 (Agent State Monitor 용 OPEN_REQ 메시지임)
   cisco::session::OpenReq open_req{};
-  open_req.setInvokeID(getInvokeID());
+  open_req.setInvokeID(addInvokeID());
   open_req.setVersionNumber(24);
   open_req.setIdleTimeout(300);
   open_req.setCallMessageMask(0xffff'ffff);
   open_req.setServicesRequested(0x80 | 0x10 | 0x04);
   open_req.setAgentStateMask(0x3fff);
   open_req.setConfigMessageMask(0);
-  open_req.setPeripheralID(5000);
+  open_req.setPeripheralID(peripheral_id);
   open_req.setClientID("ctmonitor");
   open_req.setClientPW("");
 
-  const vector<byte> packet = cisco::common::serialize(open_req);
-  client_socket.sendBytes(packet.data(), packet.size());
+  // 세션당 OPEN_REQ 는 한 번만 보내야 하므로 재전송하지 않고, 기한 안에
+  // OPEN_CONF 가 오지 않으면 접속 실패로 처리한다
+  sendRequest(open_req.getInvokeID(), cisco::common::MessageType::OPEN_REQ,
+              cisco::common::serialize(open_req), false);
 
-  // HeartBeat 전송 스레드 실행
-  thread heartbeat_thread{[&]() {
-    while (getCurrentState() == FiniteState::CONNECTED) {
-      addInvokeID();
+  spdlog::info("Sent OPEN_REQ message. cti_server_host: {}, invoke_id: {}",
+               cti_server_host, open_req.getInvokeID());
+}
 
-      cisco::session::HeartbeatReq heartbeat_req{};
-      heartbeat_req.setInvokeID(getInvokeID());
+/**
+ * @brief 수신 코루틴
+ *
+ * @return asio::awaitable<void>
+ */
+asio::awaitable<void> CTIClient::reader() {
+  while (getCurrentState() == FiniteState::CONNECTED) {
+    // 조립기에 수신 공간을 확보하고, 그 자리로 바로 수신한다
+    const span<byte> receive_buffer = frame_assembler.prepare();
+
+    asio::error_code error{};
+    const size_t length = co_await client_socket.async_read_some(
+        asio::buffer(receive_buffer.data(), receive_buffer.size()),
+        asio::redirect_error(asio::use_awaitable, error));
+
+    // 직접 닫은 경우
+    if (error == asio::error::operation_aborted) {
+      co_return;
+    }
 
-      const vector<byte> packet = cisco::common::serialize(heartbeat_req);
-      client_socket.sendBytes(packet.data(), packet.size());
+    // 상대가 끊었거나 소켓 오류
+    if (error) {
+      spdlog::warn("CTI connection closed. cti_server_host: {}, reason: {}",
+                   cti_server_host, error.message());
+      closeConnection();
+      co_return;
+    }
 
-      spdlog::info("Sent HEARTBEAT_REQ. cti_server_host: {}, invoke_id: {}",
-                   cti_server_host, heartbeat_req.getInvokeID());
+    if (!onReceived(receive_buffer.first(length))) {
+      co_return;
+    }
+  }
+}
 
-      // 스레드 sleep을 위로 올리는 경우 current_state 값을 예전 값으로
-      // 처리온다. sleep 한 사이에 소켓이 종료 되었을 수 있으니 루프문 마지막에
-      // sleep을 걸어준다.
-      this_thread::sleep_for(
-          chrono::milliseconds{heartbeat_timespan.totalMilliseconds()});
+/**
+ * @brief 수신한 바이트를 조립하고 완성된 프레임을 처리한다
+ *
+ * @param received
+ * @return true
+ * @return false
+ */
+bool CTIClient::onReceived(const span<const byte> received) {
+  frame_assembler.commit(received.size());
+
+  // 수신된 패킷 디버그 로그 출력
+  if (spdlog::should_log(spdlog::level::debug)) {
+    stringstream ss{};
+    for (size_t i = 0; i < received.size(); i++) {
+      ss << std::setfill('0') << std::setw(2) << std::hex
+         << static_cast<int32_t>(received[i]) << " ";
+
+      if (i % 4 == 3) {
+        ss << " ";
+      }
+
+      if (i % 16 == 15) {
+        ss << "\n";
+      }
     }
-  }};
-  heartbeat_thread.detach();
+    spdlog::debug("Received packet. cti_server_host: {}\n{}", cti_server_host,
+                  ss.str());
+  }
 
-  spdlog::info("Sent OPEN_REQ message. cti_server_host: {}, invoke_id: {}",
-               cti_server_host, open_req.getInvokeID());
+  // 완성된 프레임만 꺼내고, 여러 번의 수신에 걸친 프레임은 남겨 둔다
+  // (MHDR 을 한 번만 훑어 프레임 경계도 함께 구한다)
+  span<const byte> frames{};
+  try {
+    frames = frame_assembler.takeFrames(frame_boundaries);
+  } catch (const length_error &e) {
+    // MHDR 길이가 비정상이면 스트림 경계를 잃은 것이므로 연결을 끊는다
+    spdlog::error("Invalid CTI frame. cti_server_host: {}, reason: {}",
+                  cti_server_host, e.what());
+    closeConnection();
+    return false;
+  }
+
+  if (frame_boundaries.empty()) {
+    return true;
+  }
+
+  onConfirmations(frames);
+
+  // 대기 세션은 연결 상태만 확인하고 이벤트는 배포하지 않는다
+  if (isStandby()) {
+    return true;
+  }
+
+  // 같은 수신에서 완성된 프레임은 한 레코드로 기록한다
+  if (capture_writer) {
+    capture_writer->write(frames);
+  }
+
+  // 완성된 프레임들과 경계는 배치 아레나에 한 번만 복사하고, 묶음 하나로
+  // 세션의 이벤트 처리 스레드에 넘긴다. 디코딩은 세션마다 따로 하고, 이벤트가
+  // 처리되면 아레나가 한 번에 해제된다
+  cti_event_worker->publish(channel::event::CTIEvent{
+      make_shared<const channel::event::CTIReadBatch>(frames, frame_boundaries),
+      peripheral_id});
+
+  return true;
 }
 
 /**
- * @brief CTI 서버 접속 해제
+ * @brief 송신 코루틴
  *
+ * @return asio::awaitable<void>
  */
-void CTIClient::disconnect() noexcept {
-  spdlog::info("CTI Server disconnected. cti_server_host: {}", cti_server_host);
-  current_state.store(FiniteState::FINISHED, memory_order::release);
-  client_socket_reactor.stop();
+asio::awaitable<void> CTIClient::writer() {
+  while (getCurrentState() == FiniteState::CONNECTED) {
+    // 송신 대기열에 패킷이 들어와 깨워질 때까지 기다린다
+    if (!is_write_requested) {
+      asio::error_code error{};
+      co_await write_signal.async_wait(
+          asio::redirect_error(asio::use_awaitable, error));
+      continue;
+    }
+    is_write_requested = false;
+
+    // 쌓인 요청을 한 번의 송신으로 보내고, 소켓 송신 버퍼가 가득 차면 쓸 수
+    // 있을 때까지 기다렸다가 남은 위치부터 이어서 보낸다
+    while (getCurrentState() == FiniteState::CONNECTED) {
+      asio::error_code error{};
+      const SendQueue::FlushResult result =
+          send_queue.flush([&](const span<const byte> bytes) {
+            return client_socket.write_some(
+                asio::buffer(bytes.data(), bytes.size()), error);
+          });
+
+      if (error && error != asio::error::would_block &&
+          error != asio::error::try_again) {
+        spdlog::error("Unable to send to CTI Server. cti_server_host: {}, "
+                      "reason: {}",
+                      cti_server_host, error.message());
+        closeConnection();
+        co_return;
+      }
+
+      if (result == SendQueue::FlushResult::BLOCKED) {
+        co_await client_socket.async_wait(
+            asio::ip::tcp::socket::wait_write,
+            asio::redirect_error(asio::use_awaitable, error));
+        continue;
+      }
+
+      // 다 보낸 사이 새 패킷이 들어왔으면 계속 쓰기 담당을 유지한다
+      if (send_queue.disarm()) {
+        break;
+      }
+    }
+  }
 }
 
 /**
- * @brief 읽을 데이터가 있을 경우
+ * @brief 주기 작업 코루틴
  *
- * @param notification
+ * @return asio::awaitable<void>
  */
-void CTIClient::onReadableNotification(
-    const Poco::AutoPtr<Poco::Net::ReadableNotification> &notification) {
+asio::awaitable<void> CTIClient::ticker() {
+  while (getCurrentState() == FiniteState::CONNECTED) {
+    tick_timer.expires_after(tick_interval);
+
+    asio::error_code error{};
+    co_await tick_timer.async_wait(
+        asio::redirect_error(asio::use_awaitable, error));
+    if (error) {
+      co_return;
+    }
 
-  // 수신된 패킷 디버그 로그 출력
-  size_t length =
-      client_socket.receiveBytes(receive_buffer.data(), receive_buffer.size());
+    onTick();
+  }
+}
 
-  // 들어온 메시지 길이가 0인 경우 소켓이 끊어졌다 판단
-  if (length < 0) {
-    current_state.store(FiniteState::FINISHED, memory_order::release);
-    channel::EventChannel<channel::event::CTIErrorEvent>::getInstance()
-        ->publish(channel::event::CTIErrorEvent(
-            getCTIServerHost(),
-            channel::event::CTIErrorEvent::CTIErrorType::CONNECTION_LOST));
-    client_socket.close();
+/**
+ * @brief 세션 코루틴 시작
+ *
+ * @param coroutine
+ */
+void CTIClient::spawn(asio::awaitable<void> coroutine) {
+  {
+    lock_guard<mutex> lock{loop_work_mutex};
+    loop_work_count++;
+  }
+
+  asio::co_spawn(io_context, std::move(coroutine),
+                 [this](const exception_ptr error) {
+                   if (error) {
+                     try {
+                       rethrow_exception(error);
+                     } catch (const exception &e) {
+                       spdlog::error("CTI session coroutine failed. "
+                                     "cti_server_host: {}, reason: {}",
+                                     cti_server_host, e.what());
+                     }
+                     closeConnection();
+                   }
+
+                   finishLoopWork();
+                 });
+}
+
+/**
+ * @brief 루프 스레드에서 실행한다
+ *
+ * @param task
+ */
+void CTIClient::post(function<void()> task) {
+  {
+    lock_guard<mutex> lock{loop_work_mutex};
+    loop_work_count++;
+  }
+
+  asio::post(io_context, [this, task = std::move(task)]() {
+    task();
+    finishLoopWork();
+  });
+}
+
+/**
+ * @brief 루프에 넘긴 작업 하나가 끝났음을 알린다
+ *
+ * 알림까지 잠금 안에서 해야 기다리던 소멸자가 먼저 깨어나 조건 변수를
+ * 해제하지 않는다.
+ */
+void CTIClient::finishLoopWork() {
+  lock_guard<mutex> lock{loop_work_mutex};
+  loop_work_count--;
+  loop_work_condition.notify_all();
+}
+
+/**
+ * @brief 대기 세션을 운영 세션으로 전환
+ *
+ * 쌓아 둔 조회와 함께 알고 있는 상담원 전체를 다시 조회해, 끊긴 세션에서
+ * 놓쳤을 수 있는 상태를 맞춘다. 조회는 주기 작업 코루틴이 정해진 속도로
+ * 보낸다.
+ */
+void CTIClient::promote() {
+  is_standby.store(false, memory_order::release);
+  const size_t requeued = query_pacer.requeueAll();
+
+  spdlog::info("Standby CTI session promoted. cti_server_host: {}, "
+               "requeued: {}, queued: {}",
+               cti_server_host, requeued, query_pacer.getQueuedCount());
+}
+
+/**
+ * @brief 상담원 조회 대상을 미리 넣어 둔다
+ *
+ * @param agents
+ */
+void CTIClient::seedAgents(const vector<QueryPacer::AgentQuery> &agents) {
+  for (const QueryPacer::AgentQuery &agent : agents) {
+    query_pacer.push(agent);
+  }
+}
+
+/**
+ * @brief 송신 대기열에 패킷을 넣는다
+ *
+ * @param packet
+ */
+void CTIClient::send(const span<const byte> packet) {
+  switch (send_queue.push(packet)) {
+  case SendQueue::PushResult::QUEUED:
+    break;
+  case SendQueue::PushResult::ARMED:
+    // 송신 코루틴을 깨운다 (타이머는 루프 스레드에서만 다룬다)
+    post([this]() {
+      is_write_requested = true;
+      write_signal.cancel();
+    });
+    break;
+  case SendQueue::PushResult::OVERFLOW:
+    spdlog::warn("CTI send queue overflowed, packet dropped. "
+                 "cti_server_host: {}, pending_size: {}",
+                 cti_server_host, send_queue.getPendingSize());
+    break;
+  }
+}
+
+/**
+ * @brief 주기마다 호출
+ *
+ */
+void CTIClient::onTick() {
+  if (getCurrentState() != FiniteState::CONNECTED) {
     return;
   }
 
-  stringstream ss{};
-  for (int i = 0; i < length; i++) {
-    ss << std::setfill('0') << std::setw(2) << std::hex
-       << static_cast<int32_t>(receive_buffer.at(i)) << " ";
+  const HeartbeatMonitor::clock::time_point now =
+      HeartbeatMonitor::clock::now();
+
+  // 기한이 지난 요청은 같은 Invoke ID 로 다시 보내고, 재전송 횟수를 넘기면
+  // 포기한다 (재전송은 한 번에 모아서 로그를 남긴다)
+  size_t retried = 0;
+  size_t dropped = 0;
+  bool is_open_timed_out = false;
+  request_table.expire(
+      now,
+      [&](const RequestTable::Request &request) {
+        send(request.packet);
+        retried++;
+      },
+      [&](const RequestTable::Request &request) {
+        dropped++;
+        if (request.message_type ==
+            cisco::common::MessageType::QUERY_AGENT_STATE_REQ) {
+          query_pacer.onFinished(request.invoke_id);
+        }
+        if (request.message_type == cisco::common::MessageType::OPEN_REQ) {
+          is_open_timed_out = true;
+        }
+        spdlog::error("CTI request timed out. cti_server_host: {}, "
+                      "invoke_id: {}, message_type: {}, retry_count: {}",
+                      cti_server_host, request.invoke_id,
+                      static_cast<uint32_t>(request.message_type),
+                      request.retry_count);
+      });
+  if (retried != 0 || dropped != 0) {
+    spdlog::warn("CTI requests expired. cti_server_host: {}, retried: {}, "
+                 "dropped: {}, outstanding: {}",
+                 cti_server_host, retried, dropped, request_table.size());
+  }
+
+  // OPEN_CONF 를 받지 못한 세션은 쓸 수 없으므로 끊고 재접속에 맡긴다
+  if (is_open_timed_out) {
+    spdlog::error("OPEN_CONF not received. cti_server_host: {}",
+                  cti_server_host);
+    closeConnection();
+    return;
+  }
+
+  // 대기 세션은 조회를 쌓아 두기만 하고, 운영 세션이 되면 보낸다
+  if (!isStandby()) {
+    sendAgentQueries(now);
+  }
+
+  // 주기 안에 HEARTBEAT_CONF 가 오지 않은 요청은 누락으로 처리
+  if (const size_t missed = heartbeat_monitor.expire(now); missed != 0) {
+    spdlog::warn("HEARTBEAT_CONF missed. cti_server_host: {}, "
+                 "consecutive_missed: {}, total_missed: {}",
+                 cti_server_host, heartbeat_monitor.getConsecutiveMissed(),
+                 heartbeat_monitor.getTotalMissed());
+  }
+
+  // 연속으로 누락되면 TCP 타임아웃을 기다리지 않고 연결을 끊는다
+  if (heartbeat_monitor.isDead()) {
+    spdlog::error("CTI Server not responding to heartbeats. "
+                  "cti_server_host: {}, consecutive_missed: {}",
+                  cti_server_host, heartbeat_monitor.getConsecutiveMissed());
+    closeConnection();
+    return;
+  }
+
+  if (!heartbeat_monitor.isDue(now)) {
+    return;
+  }
+
+  // 패킷은 한 번만 직렬화하고 Invoke ID 만 바꾼다
+  const uint32_t invoke_id = addInvokeID();
+  heartbeat_template.set<&cisco::session::HeartbeatReq::getInvokeID>(
+      invoke_id);
 
-    if (i % 4 == 3) {
-      ss << " ";
+  send(heartbeat_template.getPacket());
+  heartbeat_monitor.onSent(invoke_id, now);
+
+  spdlog::debug("Sent HEARTBEAT_REQ. cti_server_host: {}, invoke_id: {}",
+                cti_server_host, invoke_id);
+}
+
+/**
+ * @brief 송신 속도와 응답 대기 상한 안에서 상담원 상태 조회를 보낸다
+ *
+ * @param now
+ */
+void CTIClient::sendAgentQueries(const QueryPacer::clock::time_point now) {
+  if (query_pacer.take(now, agent_query_batch) == 0) {
+    return;
+  }
+
+  for (const QueryPacer::AgentQuery &query : agent_query_batch) {
+    const uint32_t invoke_id = addInvokeID();
+
+    // 미리 직렬화한 템플릿에 바뀌는 필드만 덮어쓴다
+    query_agent_state_template
+        .set<&cisco::control::QueryAgentStateReq::getInvokeID>(invoke_id);
+    query_agent_state_template
+        .set<&cisco::control::QueryAgentStateReq::getPeripheralID>(
+            query.peripheral_id);
+    query_agent_state_template.setFloating(
+        cisco::common::TagValue::AGENT_ID_TAG, query.agent_id);
+
+    // Query Agent State 커맨드를 응답 대기 요청으로 등록하고 보낸다
+    sendRequest(invoke_id, cisco::common::MessageType::QUERY_AGENT_STATE_REQ,
+                query_agent_state_template.getPacket());
+    query_pacer.onSent(invoke_id, query);
+
+    spdlog::debug("Sent QUERY_AGENT_STATE_REQ. cti_server_host: {}, "
+                  "invoke_id: {}, peripheral_id: {}, agent_id: {}",
+                  cti_server_host, invoke_id, query.peripheral_id,
+                  query.agent_id);
+  }
+
+  spdlog::info("Sent QUERY_AGENT_STATE_REQ batch. cti_server_host: {}, "
+               "sent: {}, queued: {}, in_flight: {}, folded: {}",
+               cti_server_host, agent_query_batch.size(),
+               query_pacer.getQueuedCount(), query_pacer.getInFlightCount(),
+               query_pacer.getFoldedCount());
+}
+
+/**
+ * @brief 수신 프레임 중 응답 메시지를 찾아 요청과 맞춘다
+ *
+ * @param frames
+ */
+void CTIClient::onConfirmations(const span<const byte> frames) {
+  // MHDR(길이, 유형) 다음에 Invoke ID 가 온다
+  constexpr size_t type_offset = sizeof(uint32_t);
+  constexpr size_t invoke_id_offset = type_offset + sizeof(uint32_t);
+
+  for (const cisco::common::FrameBoundary &boundary : frame_boundaries) {
+    if (boundary.length < invoke_id_offset + sizeof(uint32_t)) {
+      continue;
     }
 
-    if (i % 16 == 15) {
-      ss << "\n";
+    const byte *frame = frames.data() + boundary.offset;
+    const cisco::common::MessageType message_type =
+        cisco::common::detail::load<cisco::common::MessageType>(frame +
+                                                                type_offset);
+    switch (message_type) {
+    case cisco::common::MessageType::HEARTBEAT_CONF:
+    case cisco::common::MessageType::OPEN_CONF:
+    case cisco::common::MessageType::QUERY_AGENT_STATE_CONF:
+    case cisco::common::MessageType::FAILURE_CONF:
+    case cisco::common::MessageType::CONTROL_FAILURE_CONF:
+      break;
+    default:
+      continue;
+    }
+
+    const uint32_t invoke_id =
+        cisco::common::detail::load<uint32_t>(frame + invoke_id_offset);
+    const RequestTable::clock::time_point now = RequestTable::clock::now();
+
+    // 하트비트는 누락 판단을 위해 따로 추적한다
+    if (message_type == cisco::common::MessageType::HEARTBEAT_CONF) {
+      const optional<HeartbeatMonitor::clock::duration> round_trip =
+          heartbeat_monitor.onConf(invoke_id, now);
+      if (!round_trip) {
+        spdlog::warn("Unexpected HEARTBEAT_CONF. cti_server_host: {}, "
+                     "invoke_id: {}",
+                     cti_server_host, invoke_id);
+        continue;
+      }
+
+      const util::LatencyHistogram &histogram =
+          heartbeat_monitor.getRoundTripHistogram();
+      spdlog::info(
+          "Received HEARTBEAT_CONF. cti_server_host: {}, invoke_id: {}, "
+          "rtt_us: {}, p50_us: {}, p99_us: {}, max_us: {}, total_missed: {}",
+          cti_server_host, invoke_id,
+          chrono::duration_cast<chrono::microseconds>(*round_trip).count(),
+          histogram.getPercentile(50).count(),
+          histogram.getPercentile(99).count(), histogram.getMax().count(),
+          heartbeat_monitor.getTotalMissed());
+      continue;
+    }
+
+    const optional<RequestTable::Completion> completion =
+        request_table.complete(invoke_id, now);
+    if (!completion) {
+      // 재전송한 요청의 늦은 응답이거나 이미 포기한 요청
+      spdlog::debug("Unmatched CTI confirmation. cti_server_host: {}, "
+                    "invoke_id: {}, message_type: {}",
+                    cti_server_host, invoke_id,
+                    static_cast<uint32_t>(message_type));
+      continue;
+    }
+
+    if (completion->message_type ==
+        cisco::common::MessageType::QUERY_AGENT_STATE_REQ) {
+      const uint32_t interest = query_pacer.onFinished(invoke_id);
+      if (interest > 1) {
+        spdlog::debug("QUERY_AGENT_STATE_CONF answered folded queries. "
+                      "cti_server_host: {}, invoke_id: {}, interest: {}",
+                      cti_server_host, invoke_id, interest);
+      }
+    }
+
+    if (message_type == cisco::common::MessageType::FAILURE_CONF ||
+        message_type == cisco::common::MessageType::CONTROL_FAILURE_CONF) {
+      spdlog::warn("CTI request failed. cti_server_host: {}, invoke_id: {}, "
+                   "request_type: {}, conf_type: {}",
+                   cti_server_host, invoke_id,
+                   static_cast<uint32_t>(completion->message_type),
+                   static_cast<uint32_t>(message_type));
+    }
+
+    // 대기 중이거나 보낼 요청이 모두 응답되면 유형별 지연 통계를 남긴다.
+    // 요청이 여럿 몰렸다가 비워진 경우 (팀 구성 직후의 초기 조회 완료 등)
+    // 만 info 로 남기고, 요청 하나가 오갈 때마다 비워지는 경우는 debug 로
+    // 남긴다
+    if (request_table.size() == 0 && query_pacer.getQueuedCount() == 0) {
+      const spdlog::level::level_enum level =
+          had_request_burst ? spdlog::level::info : spdlog::level::debug;
+      had_request_burst = false;
+
+      spdlog::log(level, "All outstanding CTI requests answered. "
+                         "cti_server_host: {}",
+                  cti_server_host);
+      logRequestStats(level);
     }
-  }
-  spdlog::debug("Received packet. cti_server_host: {}\n{}", cti_server_host,
-                ss.str());
-
-  // 메시지 헤더 MHDR 정보를 이용해, 여러 패킷이 동시에 수신된 경우 분리하여
-  // 이벤트를 배포한다
-  size_t packet_index = 0;
-  vector<byte> seperator_buffer{};
-  while (packet_index < length) {
-    // 분리용 버퍼에 수신 버퍼 복사
-    seperator_buffer = vector<byte>{receive_buffer.cbegin() + packet_index,
-                                    receive_buffer.cend()};
-    // 메시지 헤더 분리
-    cisco::common::MHDR mhdr =
-        cisco::common::deserialize<cisco::common::MHDR>(seperator_buffer);
-    // 현재 처리중 패킷 위치 누산 (8 = MHDR 길이)
-    packet_index += mhdr.getMessageLength() + 8;
-    // CTI 이벤트 배포
-    channel::EventChannel<channel::event::CTIEvent>::getInstance()->publish(
-        channel::event::CTIEvent{seperator_buffer});
   }
 }
 
 /**
- * @brief 오류 알림 수신
+ * @brief 메시지 유형별 요청-응답 지연 통계 로그
  *
- * @param notification
+ * @param level
  */
-void CTIClient::onErrorNotification(
-    const Poco::AutoPtr<Poco::Net::ErrorNotification> &notification) {
-  // 이미 오류 핸들링 된 경우는 처리하지 않는다
-  if (getCurrentState() == FiniteState::FINISHED) {
+void CTIClient::logRequestStats(const spdlog::level::level_enum level) const {
+  if (!spdlog::should_log(level)) {
     return;
   }
 
-  // 오류 핸들링
-  current_state.store(FiniteState::FINISHED, memory_order::release);
-  client_socket_reactor.stop();
+  for (const auto &[message_type, stats] : request_table.getStats()) {
+    spdlog::log(level,
+                "CTI request latency. cti_server_host: {}, "
+                "message_type: {}, count: {}, mean_us: {}, p50_us: {}, "
+                "p90_us: {}, p99_us: {}, max_us: {}, retried: {}, "
+                "timed_out: {}",
+                cti_server_host, static_cast<uint32_t>(message_type),
+                stats.latency.getCount(), stats.latency.getMean().count(),
+                stats.latency.getPercentile(50).count(),
+                stats.latency.getPercentile(90).count(),
+                stats.latency.getPercentile(99).count(),
+                stats.latency.getMax().count(), stats.retried,
+                stats.timed_out);
+  }
+}
 
-  // 오류 메시지 전송
-  EventChannel<event::CTIErrorEvent>::getInstance()->publish(
-      event::CTIErrorEvent{
-          getCTIServerHost(),
-          event::CTIErrorEvent::CTIErrorType::CONNECTION_LOST});
+/**
+ * @brief 연결이 끊긴 것으로 처리하고 CONNECTION_LOST 를 알린다
+ *
+ */
+void CTIClient::closeConnection() {
+  // 이미 끊겼거나 직접 접속 해제한 경우는 알리지 않는다
+  if (current_state.exchange(FiniteState::FINISHED, memory_order::acq_rel) ==
+      FiniteState::FINISHED) {
+    closeSocket();
+    return;
+  }
 
-  spdlog::warn("Error notified from CTI Server. cti_server_host: {}",
-               cti_server_host);
+  channel::EventChannel<channel::event::CTIErrorEvent>::getInstance()->publish(
+      channel::event::CTIErrorEvent(
+          session_name, getCTIServerHost(),
+          channel::event::CTIErrorEvent::CTIErrorType::CONNECTION_LOST));
+  closeSocket();
 }
 
 /**
- * @brief 종료 알림 수신
+ * @brief 소켓을 닫고 세션 코루틴들을 깨운다
  *
- * @param notification
  */
-void CTIClient::onShutdownNotification(
-    const Poco::AutoPtr<Poco::Net::ShutdownNotification> &notification) {
-  current_state.store(FiniteState::FINISHED, memory_order::release);
-  client_socket_reactor.stop();
+void CTIClient::closeSocket() {
+  asio::error_code error{};
+  client_socket.shutdown(asio::ip::tcp::socket::shutdown_both, error);
+  client_socket.close(error);
+  write_signal.cancel();
+  tick_timer.cancel();
+}
+
+/**
+ * @brief 응답을 기다리는 요청을 등록하고 송신 대기열에 넣는다
+ *
+ * 응답이 송신보다 먼저 처리되지 않도록 등록을 먼저 한다.
+ *
+ * @param invoke_id
+ * @param message_type
+ * @param packet
+ * @param is_retryable
+ */
+void CTIClient::sendRequest(const uint32_t invoke_id,
+                            const cisco::common::MessageType message_type,
+                            const span<const byte> packet,
+                            const bool is_retryable) {
+  if (!request_table.insert(invoke_id, message_type, packet,
+                            RequestTable::clock::now(), is_retryable)) {
+    spdlog::warn("Duplicated invoke_id in outstanding requests. "
+                 "cti_server_host: {}, invoke_id: {}",
+                 cti_server_host, invoke_id);
+  }
+  if (request_table.size() > 1) {
+    had_request_burst = true;
+  }
+
+  send(packet);
 }
 
 /**
@@ -311,21 +938,22 @@ void CTIClient::handleEvent(const event::Event *event) {
 
       std::regex_match(buffer, match, regexp);
 
-      cisco::control::QueryAgentStateReq query_agent_state_req{};
-      addInvokeID();
-      query_agent_state_req.setInvokeID(getInvokeID());
-      query_agent_state_req.setPeripheralID(std::stoi(match[1].str()));
-      query_agent_state_req.setAgentID(match[2].str());
-
-      // Query Agent State 커맨드를 전송한다
-      client_socket.sendBytes(
-          cisco::common::serialize(query_agent_state_req).data(),
-          cisco::common::serialize(query_agent_state_req).size());
-
-      spdlog::info("Sent QUERY_AGENT_STATE_REQ. cti_server_host: {}, "
-                   "invoke_id: {}, agent_id: {}",
-                   cti_server_host, query_agent_state_req.getInvokeID(),
-                   query_agent_state_req.getAgentID().value());
+      // 다른 Peripheral 의 상담원은 그 Peripheral 을 맡은 세션이 조회한다
+      const uint32_t query_peripheral_id =
+          static_cast<uint32_t>(std::stoul(match[1].str()));
+      if (query_peripheral_id != peripheral_id) {
+        return;
+      }
+
+      // 바로 보내지 않고 주기 작업 코루틴이 정해진 속도로 보낸다. 같은
+      // 상담원 조회가 이미 대기 중이면 그 요청에 합친다
+      const bool queued = query_pacer.push(
+          QueryPacer::AgentQuery{query_peripheral_id, match[2].str()});
+
+      spdlog::debug("{} QUERY_AGENT_STATE_REQ. cti_server_host: {}, "
+                    "agent_id: {}",
+                    queued ? "Queued" : "Folded", cti_server_host,
+                    match[2].str());
     } break;
     case event::BridgeEvent::BridgeEventType::BROADCAST_AGENT_STATE:
       break;
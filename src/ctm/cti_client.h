@@ -3,28 +3,63 @@
 #ifndef _CTM_CTM_CTI_CLIENT_H_
 #define _CTM_CTM_CTI_CLIENT_H_
 
+#include "../channel/event/cti_event.hpp"
+#include "../channel/event_worker.hpp"
 #include "../channel/subscriber.hpp"
+#include "../cisco/common/frame_assembler.hpp"
+#include "../cisco/common/request_template.hpp"
+#include "../cisco/control/query_agent_state_req.hpp"
+#include "../cisco/session/heartbeat_req.hpp"
+#include "./capture/cti_capture.hpp"
+#include "./cti_session_config.hpp"
+#include "./heartbeat_monitor.hpp"
+#include "./query_pacer.hpp"
+#include "./request_table.hpp"
+#include "./send_queue.hpp"
 
-#include <Poco/AutoPtr.h>
-#include <Poco/Net/SocketNotification.h>
-#include <Poco/Net/SocketReactor.h>
-#include <Poco/Net/StreamSocket.h>
-#include <Poco/Thread.h>
-#include <Poco/Timespan.h>
+#include <asio/awaitable.hpp>
+#include <asio/io_context.hpp>
+#include <asio/ip/tcp.hpp>
+#include <asio/steady_timer.hpp>
+#include <spdlog/spdlog.h>
 
 #include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <span>
 #include <string>
 #include <vector>
 
 namespace ctm {
+/**
+ * @brief CTI 서버 세션
+ *
+ * 접속, 수신 프레임 조립, 하트비트와 송신 대기열을 공유 I/O 루프(IOLoop)의
+ * 코루틴으로 처리한다. 루프 스레드가 아닌 곳에서는 송신 대기열과 조회
+ * 대기열에 넣기만 한다. 소멸은 루프 스레드가 아닌 곳에서 해야 한다.
+ */
 class CTIClient : public channel::Subscriber {
 public:
   /**
    * @brief Construct a new CTIClient object
    *
+   * 대기 세션은 접속과 하트비트만 유지하고, 수신 이벤트를 배포하지 않으며
+   * 상담원 조회도 쌓아 두기만 한다. promote() 로 운영 세션이 된다.
+   *
+   * @param config 세션 설정 (접속 정보, Peripheral ID, I/O 루프)
+   * @param is_side_a A 측 접속 여부
+   * @param is_standby 대기 세션 여부
+   * @param cti_event_worker 수신 배치를 디코딩할 세션의 이벤트 처리 스레드
+   * (세션보다 오래 살아 있어야 한다)
    */
-  CTIClient();
+  CTIClient(const CTISessionConfig &config, const bool is_side_a,
+            const bool is_standby,
+            channel::EventWorker<channel::event::CTIEvent> *cti_event_worker);
   /**
    * @brief Destroy the CTIClient object
    *
@@ -34,6 +69,13 @@ public:
   const CTIClient &operator=(const CTIClient &) = delete;
   CTIClient(const CTIClient &) = delete;
 
+  /**
+   * @brief 세션 이름 반환
+   *
+   * @return const std::string
+   */
+  const std::string getSessionName() const { return session_name; }
+
   /**
    * @brief CTI 서버 호스트 반환
    *
@@ -42,7 +84,47 @@ public:
   const std::string getCTIServerHost() const { return cti_server_host; }
 
   /**
-   * @brief CTI 서버 접속
+   * @brief 접속되어 있는지
+   *
+   * @return true
+   * @return false
+   */
+  bool isConnected() const {
+    return getCurrentState() == FiniteState::CONNECTED;
+  }
+
+  /**
+   * @brief 대기 세션인지
+   *
+   * @return true
+   * @return false
+   */
+  bool isStandby() const { return is_standby.load(std::memory_order_acquire); }
+
+  /**
+   * @brief 대기 세션을 운영 세션으로 전환하고 상담원 상태를 다시 조회한다
+   *
+   */
+  void promote();
+
+  /**
+   * @brief 상담원 조회 대상 목록 (대기 세션에 넘겨 주기 위함)
+   *
+   * @return std::vector<QueryPacer::AgentQuery>
+   */
+  std::vector<QueryPacer::AgentQuery> getKnownAgents() const {
+    return query_pacer.getKnownAgents();
+  }
+
+  /**
+   * @brief 상담원 조회 대상을 미리 넣어 둔다
+   *
+   * @param agents
+   */
+  void seedAgents(const std::vector<QueryPacer::AgentQuery> &agents);
+
+  /**
+   * @brief CTI 서버 접속 (루프 스레드에서 접속을 마칠 때까지 기다린다)
    *
    */
   void connect() noexcept;
@@ -53,13 +135,6 @@ public:
   void disconnect() noexcept;
 
 protected:
-  void onReadableNotification(
-      const Poco::AutoPtr<Poco::Net::ReadableNotification> &notification);
-  void onErrorNotification(
-      const Poco::AutoPtr<Poco::Net::ErrorNotification> &notification);
-  void onShutdownNotification(
-      const Poco::AutoPtr<Poco::Net::ShutdownNotification> &notification);
-
 private:
   enum class FiniteState : std::int32_t {
     INITIALIZED, // 초기화 상태
@@ -87,13 +162,135 @@ private:
   }
 
   /**
-   * @brief InvokeID 값 증가
+   * @brief InvokeID 값 증가 (여러 스레드에서 호출해도 겹치지 않는다)
    *
+   * @return std::uint32_t 증가된 Invoke ID
    */
-  void addInvokeID() {
-    invoke_id.store(getInvokeID() + 1, std::memory_order_release);
+  std::uint32_t addInvokeID() {
+    return invoke_id.fetch_add(1, std::memory_order_acq_rel) + 1;
   }
 
+  /**
+   * @brief 송신 대기열에 패킷을 넣는다 (모든 스레드에서 호출 가능)
+   *
+   * 실제 송신은 송신 코루틴이 소켓이 쓰기 가능할 때 모아서 한다.
+   *
+   * @param packet
+   */
+  void send(const std::span<const std::byte> packet);
+
+  /**
+   * @brief 응답을 기다리는 요청을 등록하고 송신 대기열에 넣는다
+   *
+   * @param invoke_id
+   * @param message_type
+   * @param packet
+   * @param is_retryable false 면 응답이 늦어도 재전송하지 않는다
+   */
+  void sendRequest(const std::uint32_t invoke_id,
+                   const cisco::common::MessageType message_type,
+                   const std::span<const std::byte> packet,
+                   const bool is_retryable = true);
+
+  /**
+   * @brief 접속하고 세션 코루틴들을 시작한다 (루프 스레드)
+   *
+   * @return asio::awaitable<void> 접속 실패 시 예외
+   */
+  asio::awaitable<void> open();
+
+  /**
+   * @brief 수신 코루틴 (조립기의 빈 공간으로 바로 수신한다)
+   *
+   * @return asio::awaitable<void>
+   */
+  asio::awaitable<void> reader();
+
+  /**
+   * @brief 송신 코루틴 (쌓인 요청을 한 번의 송신으로 보낸다)
+   *
+   * @return asio::awaitable<void>
+   */
+  asio::awaitable<void> writer();
+
+  /**
+   * @brief 주기 작업 코루틴
+   *
+   * @return asio::awaitable<void>
+   */
+  asio::awaitable<void> ticker();
+
+  /**
+   * @brief 세션 코루틴 시작 (종료될 때까지 소멸을 미룬다)
+   *
+   * @param coroutine
+   */
+  void spawn(asio::awaitable<void> coroutine);
+
+  /**
+   * @brief 루프 스레드에서 실행한다 (실행될 때까지 소멸을 미룬다)
+   *
+   * @param task
+   */
+  void post(std::function<void()> task);
+
+  /**
+   * @brief 루프에 넘긴 작업 하나가 끝났음을 알린다
+   *
+   */
+  void finishLoopWork();
+
+  /**
+   * @brief 수신한 바이트를 조립하고 완성된 프레임을 처리한다
+   *
+   * @param received
+   * @return true
+   * @return false 스트림 경계를 잃어 연결을 끊음
+   */
+  bool onReceived(const std::span<const std::byte> received);
+
+  /**
+   * @brief 주기마다 호출 (루프 스레드)
+   *
+   * 하트비트 송신 주기와 HEARTBEAT_CONF 누락, 응답 대기 요청의 기한을
+   * 검사하고, 대기 중인 상담원 상태 조회를 보낸다.
+   */
+  void onTick();
+
+  /**
+   * @brief 송신 속도와 응답 대기 상한 안에서 상담원 상태 조회를 보낸다
+   *
+   * @param now
+   */
+  void sendAgentQueries(const QueryPacer::clock::time_point now);
+
+  /**
+   * @brief 수신 프레임 중 응답 메시지를 찾아 요청과 맞춘다
+   *
+   * @param frames
+   */
+  void onConfirmations(const std::span<const std::byte> frames);
+
+  /**
+   * @brief 메시지 유형별 요청-응답 지연 통계 로그
+   *
+   * @param level 로그 레벨
+   */
+  void logRequestStats(const spdlog::level::level_enum level) const;
+
+  /**
+   * @brief 연결이 끊긴 것으로 처리하고 CONNECTION_LOST 를 알린다 (루프
+   * 스레드)
+   *
+   */
+  void closeConnection();
+
+  /**
+   * @brief 소켓을 닫고 세션 코루틴들을 깨운다 (루프 스레드)
+   *
+   */
+  void closeSocket();
+
   /**
    * @brief 이벤트 핸들링
    *
@@ -102,17 +299,43 @@ private:
   virtual void handleEvent(const channel::event::Event *event) override;
 
 private:
-  Poco::Net::StreamSocket client_socket{};
-  Poco::Net::SocketReactor client_socket_reactor{};
-  Poco::Timespan connection_timespan{5'000'000};
-  Poco::Timespan heartbeat_timespan{5'000'000};
+  asio::io_context &io_context;
+  asio::ip::tcp::socket client_socket;
+  asio::steady_timer write_signal;
+  asio::steady_timer tick_timer;
+  bool is_write_requested{false};
+  std::chrono::milliseconds connection_timeout{5'000};
+  std::chrono::milliseconds heartbeat_interval{5'000};
+  std::chrono::milliseconds tick_interval{100};
+  std::string cti_server_ip;
+  std::uint16_t cti_server_port;
   std::string cti_server_host;
+  std::string session_name;
+  std::uint32_t peripheral_id;
+  bool is_side_a;
+  std::atomic_bool is_standby;
+  channel::EventWorker<channel::event::CTIEvent> *cti_event_worker;
 
-  std::vector<std::byte> receive_buffer{4'096};
+  cisco::common::FrameAssembler frame_assembler{};
+  std::vector<cisco::common::FrameBoundary> frame_boundaries{};
+  std::unique_ptr<capture::CaptureWriter> capture_writer{};
+  SendQueue send_queue{};
+  HeartbeatMonitor heartbeat_monitor{std::chrono::milliseconds{5'000}, 3};
+  RequestTable request_table{std::chrono::milliseconds{5'000}, 2};
+  QueryPacer query_pacer{200.0, 50.0, 100};
+  std::vector<QueryPacer::AgentQuery> agent_query_batch{};
+  bool had_request_burst{false}; // 마지막으로 비운 뒤 요청이 여럿 대기했는지
+  cisco::common::RequestTemplate<cisco::session::HeartbeatReq>
+      heartbeat_template{cisco::session::HeartbeatReq{}};
+  cisco::common::RequestTemplate<cisco::control::QueryAgentStateReq>
+      query_agent_state_template{cisco::control::QueryAgentStateReq{}};
   std::atomic_uint32_t invoke_id{0};
   std::atomic<FiniteState> current_state{FiniteState::INITIALIZED};
 
-  Poco::Thread reactor_thread;
+  // 루프에서 아직 끝나지 않은 코루틴과 작업 수
+  std::mutex loop_work_mutex{};
+  std::condition_variable loop_work_condition{};
+  std::size_t loop_work_count{0};
 };
 } // namespace ctm
 
@@ -0,0 +1,207 @@
+#include "./cti_session.h"
+#include "../channel/event/cti_error_event.hpp"
+#include "./bridge/message_bridge.hpp"
+#include "./client_retirer.hpp"
+#include "./cti_client.h"
+#include "./cti_session_config.hpp"
+#include "./io_loop.hpp"
+#include "./query_pacer.hpp"
+#include "./reconnect_scheduler.hpp"
+
+#include <spdlog/spdlog.h>
+
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace std;
+using namespace channel::event;
+
+namespace ctm {
+/**
+ * @brief Construct a new CTISession::CTISession object
+ *
+ * @param config
+ */
+CTISession::CTISession(const CTISessionConfig &config)
+    : config{config},
+      cti_event_worker{bridge::MessageBridge::getInstance()} {
+  // 재접속은 이벤트 채널 스레드를 막지 않도록 스케줄러 스레드에서 한다
+  const ReconnectScheduler::Policy reconnect_policy{
+      .initial_delay =
+          chrono::milliseconds{config.get("reconnect.delay.initial", 500)},
+      .max_delay =
+          chrono::milliseconds{config.get("reconnect.delay.max", 30'000)},
+      .jitter = config.get("reconnect.jitter", 0.2)};
+  reconnect_scheduler = make_unique<ReconnectScheduler>(
+      reconnect_policy, [this]() { return reconnectActive(); });
+  standby_reconnect_scheduler = make_unique<ReconnectScheduler>(
+      reconnect_policy, [this]() { return connectStandby(); });
+
+  is_standby_enabled = config.get("standby.enabled", false);
+
+  spdlog::info("CTI session configured. session: {}, peripheral_id: {}, "
+               "loop_index: {}, standby_enabled: {}",
+               config.name, config.peripheral_id, config.loop_index,
+               is_standby_enabled);
+  if (config.loop_index == 0) {
+    spdlog::warn("CTI session shares I/O loop 0 with client acceptors. "
+                 "session: {}, io_threads: {}",
+                 config.name, IOLoop::getInstance()->size());
+  }
+}
+
+/**
+ * @brief 운영 측에 접속하고, 설정되어 있으면 대기 측 접속을 예약한다
+ *
+ */
+void CTISession::start() {
+  // CTI Client 생성 및 접속 (접속은 잠금 없이 하고, 실패하면 재접속을
+  // 예약한다)
+  unique_ptr<CTIClient> client =
+      make_unique<CTIClient>(config, client_state.isActive(), false,
+                             &cti_event_worker);
+  client->connect();
+  if (client->isConnected()) {
+    lock_guard<mutex> lock{cti_client_mutex};
+    cti_client = std::move(client);
+  } else {
+    reconnect_scheduler->schedule();
+  }
+
+  // 대기 측에도 미리 접속해 두고, 절체 시 바로 운영 세션으로 전환한다
+  if (is_standby_enabled) {
+    standby_reconnect_scheduler->schedule();
+  }
+}
+
+/**
+ * @brief 운영 세션 재접속 시도
+ *
+ * @return true
+ * @return false
+ */
+bool CTISession::reconnectActive() {
+  // CG 는 곧바로 반대 측으로 절체되지 않으므로, 한 측만 두드리지 않고
+  // 시도마다 번갈아 접속한다
+  client_state.toggleActive();
+  client_state.addRetryCount();
+
+  spdlog::info("Reconnecting to CTI Server. session: {}, side: {}, "
+               "retry_count: {}",
+               config.name, client_state.isActive() ? "A" : "B",
+               client_state.getRetryCount());
+
+  // 접속은 잠금 없이 하고, 성공한 세션만 교체한다
+  unique_ptr<CTIClient> client =
+      make_unique<CTIClient>(config, client_state.isActive(), false,
+                             &cti_event_worker);
+  client->connect();
+  if (!client->isConnected()) {
+    return false;
+  }
+
+  // 잠금 안에서는 교체만 하고, 이전 세션은 잠금을 푼 뒤 이 스레드에서
+  // 소멸시킨다 (소멸자는 I/O 루프를 기다린다)
+  {
+    lock_guard<mutex> lock{cti_client_mutex};
+    cti_client.swap(client);
+    if (client) {
+      cti_client->seedAgents(client->getKnownAgents());
+    }
+  }
+  client.reset();
+  client_state.resetRetryCount();
+
+  if (is_standby_enabled) {
+    standby_reconnect_scheduler->schedule();
+  }
+
+  return true;
+}
+
+/**
+ * @brief 현재 대기 측에 대기 세션 접속 시도
+ *
+ * @return true
+ * @return false
+ */
+bool CTISession::connectStandby() {
+  unique_ptr<CTIClient> client =
+      make_unique<CTIClient>(config, !client_state.isActive(), true,
+                             &cti_event_worker);
+  client->connect();
+  if (!client->isConnected()) {
+    return false;
+  }
+
+  lock_guard<mutex> lock{cti_client_mutex};
+
+  // 시도하는 사이 절체되어 같은 측을 가리키게 되었으면 다시 시도한다
+  if (!cti_client || !cti_client->isConnected() ||
+      cti_client->getCTIServerHost() == client->getCTIServerHost()) {
+    return false;
+  }
+
+  // 운영 세션이 알고 있는 상담원을 넘겨 두어, 전환 직후 다시 조회한다
+  // (접속 시 조회 대기열을 비우므로 접속 후에 넣는다)
+  client->seedAgents(cti_client->getKnownAgents());
+
+  // 남아 있던 대기 세션은 잠금이 먼저 풀린 뒤 client 와 함께 소멸한다
+  standby_cti_client.swap(client);
+
+  return true;
+}
+
+/**
+ * @brief 이 세션의 CTI 오류 처리
+ *
+ * @param event
+ */
+void CTISession::handleError(const CTIErrorEvent &event) {
+  const string error_host = event.getErrorHost();
+
+  // 닫을 세션은 잠금 안에서 꺼내기만 하고, 소멸은 정리 스레드에 맡긴다
+  // (채널 스레드에서 소멸시키면 루프의 오류 이벤트 발행과 서로 기다린다)
+  unique_ptr<CTIClient> retired_client{};
+  {
+    lock_guard<mutex> lock{cti_client_mutex};
+
+    if (standby_cti_client &&
+        error_host == standby_cti_client->getCTIServerHost()) {
+      // 대기 세션 오류는 대기 세션만 다시 연다
+      retired_client = std::move(standby_cti_client);
+      standby_reconnect_scheduler->schedule();
+    } else if (!cti_client || error_host != cti_client->getCTIServerHost()) {
+      // 이미 교체된 세션이나 접속 시도 중인 세션의 오류는 무시한다
+      return;
+    } else if (standby_cti_client && standby_cti_client->isConnected()) {
+      // 대기 세션이 살아 있으면 새로 접속하지 않고 바로 전환한다
+      client_state.toggleActive();
+      client_state.resetRetryCount();
+      retired_client = std::exchange(cti_client, std::move(standby_cti_client));
+      cti_client->promote();
+
+      spdlog::info("CTI failover to standby session. session: {}, "
+                   "cti_server_host: {}",
+                   config.name, cti_client->getCTIServerHost());
+
+      // 장애가 난 측이 새 대기 측이 된다
+      standby_reconnect_scheduler->schedule();
+    } else {
+      // 이중화 절체는 재접속 스케줄러가 대기 시간을 두고 번갈아 시도한다
+      retired_client = std::move(standby_cti_client);
+      if (reconnect_scheduler->schedule()) {
+        spdlog::info(
+            "CTI reconnect scheduled. session: {}, cti_server_host: {}",
+            config.name, error_host);
+      }
+    }
+  }
+
+  client_retirer.retire(std::move(retired_client));
+}
+} // namespace ctm
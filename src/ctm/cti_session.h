@@ -0,0 +1,105 @@
+#pragma once
+
+#ifndef _CTM_CTM_CTI_SESSION_H_
+#define _CTM_CTM_CTI_SESSION_H_
+
+#include "../channel/event/cti_error_event.hpp"
+#include "../channel/event/cti_event.hpp"
+#include "../channel/event_worker.hpp"
+#include "./client_retirer.hpp"
+#include "./client_state.hpp"
+#include "./cti_client.h"
+#include "./cti_session_config.hpp"
+#include "./reconnect_scheduler.hpp"
+
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace ctm {
+/**
+ * @brief CTI 세션 (Peripheral 또는 CG 이중화 쌍 하나)
+ *
+ * 운영 세션과 대기 세션, 재접속 스케줄러와 현재 운영 측을 세션마다 따로
+ * 둔다. 수신 배치는 세션마다 자기 이벤트 처리 스레드에서 디코딩하고, 디코딩한
+ * 상담원 상태만 공유 상담원 맵에 모인다.
+ */
+class CTISession {
+public:
+  /**
+   * @brief Construct a new CTISession object
+   *
+   * @param config
+   */
+  explicit CTISession(const CTISessionConfig &config);
+
+  /**
+   * @brief Destroy the CTISession object
+   *
+   */
+  virtual ~CTISession() = default;
+
+  const CTISession &operator=(const CTISession &) = delete;
+  CTISession(const CTISession &) = delete;
+
+  /**
+   * @brief 세션 이름 반환
+   *
+   * @return const std::string
+   */
+  const std::string getName() const { return config.name; }
+
+  /**
+   * @brief 운영 측에 접속하고, 설정되어 있으면 대기 측 접속을 예약한다
+   *
+   */
+  void start();
+
+  /**
+   * @brief 이 세션의 CTI 오류 처리 (이벤트 채널 스레드)
+   *
+   * @param event
+   */
+  void handleError(const channel::event::CTIErrorEvent &event);
+
+protected:
+private:
+  /**
+   * @brief 운영 세션 재접속 시도 (재접속 스케줄러 스레드)
+   *
+   * 시도할 때마다 반대 측으로 전환해 접속한다.
+   *
+   * @return true 접속 성공
+   * @return false 접속 실패
+   */
+  bool reconnectActive();
+
+  /**
+   * @brief 현재 대기 측에 대기 세션 접속 시도 (재접속 스케줄러 스레드)
+   *
+   * @return true 접속 성공
+   * @return false 접속 실패 (운영 세션이 없어도 실패로 본다)
+   */
+  bool connectStandby();
+
+  CTISessionConfig config;
+  ClientState client_state{};
+  bool is_standby_enabled{false};
+
+  // 수신 배치를 디코딩하는 스레드 (세션들보다 나중에 소멸한다)
+  channel::EventWorker<channel::event::CTIEvent> cti_event_worker;
+
+  // 교체된 세션을 소멸시키는 스레드 (세션들보다 나중에 소멸한다)
+  ClientRetirer client_retirer{};
+
+  std::mutex cti_client_mutex{};
+  std::unique_ptr<CTIClient> cti_client;
+  std::unique_ptr<CTIClient> standby_cti_client;
+
+  // 스케줄러가 먼저 소멸해야 시도 중인 접속이 세션을 건드리지 않는다
+  std::unique_ptr<ReconnectScheduler> reconnect_scheduler;
+  std::unique_ptr<ReconnectScheduler> standby_reconnect_scheduler;
+};
+} // namespace ctm
+
+#endif
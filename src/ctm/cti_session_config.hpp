@@ -0,0 +1,97 @@
+#pragma once
+
+#ifndef _CTM_CTM_CTI_SESSION_CONFIG_HPP_
+#define _CTM_CTM_CTI_SESSION_CONFIG_HPP_
+
+/*
+  CTI 세션 설정
+  [cti]                     <- 공통 설정 (sessions=pg1,pg2)
+    |
+    +-- [cti.pg1]           <- 세션별 설정, 없는 키는 [cti] 값을 쓴다
+    +-- [cti.pg2]
+  sessions 가 비어 있으면 [cti] 만으로 세션 하나를 연다. 세션마다 Peripheral
+  (또는 CG 이중화 쌍) 하나를 맡고, 자기 I/O 루프 스레드에서 수신해 자기 이벤트
+  처리 스레드에서 디코딩한다.
+*/
+
+#include "../util/ini_loader.h"
+#include "./io_loop.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace ctm {
+struct CTISessionConfig {
+  // 공통 설정 섹션
+  static constexpr const char *base_section = "cti";
+
+  std::string name;            // 세션 이름 (로그, 캡처 파일 이름)
+  std::string section;         // 세션 설정 섹션
+  std::uint32_t peripheral_id; // OPEN_REQ 와 상담원 조회의 Peripheral ID
+  std::size_t loop_index;      // 수신을 맡을 I/O 루프
+
+  /**
+   * @brief 세션 섹션에서 읽고, 없으면 공통 섹션 값을 쓴다
+   *
+   * @tparam T
+   * @param key
+   * @param default_value
+   * @return T
+   */
+  template <typename T>
+  T get(const std::string &key, const T default_value) const {
+    const util::IniLoader *ini_loader = util::IniLoader::getInstance();
+    return ini_loader->get(section, key,
+                           ini_loader->get(base_section, key, default_value));
+  }
+
+  /**
+   * @brief 설정된 세션 목록
+   *
+   * I/O 루프 0 은 클라이언트 접속이 쓰므로 세션은 1 번 루프부터 나눠 맡는다
+   * (IOLoop::getSessionLoopIndex).
+   *
+   * @return std::vector<CTISessionConfig>
+   */
+  static std::vector<CTISessionConfig> loadAll() {
+    const std::string session_names = util::IniLoader::getInstance()->get(
+        base_section, "sessions", std::string(""));
+
+    std::vector<std::string> names{};
+    std::stringstream ss{session_names};
+    for (std::string name{}; std::getline(ss, name, ',');) {
+      const std::size_t begin = name.find_first_not_of(" \t");
+      const std::size_t end = name.find_last_not_of(" \t");
+      if (begin != std::string::npos) {
+        names.emplace_back(name.substr(begin, end - begin + 1));
+      }
+    }
+
+    std::vector<CTISessionConfig> configs{};
+    if (names.empty()) {
+      configs.emplace_back(CTISessionConfig{"default", base_section, 0, 0});
+    }
+    for (const std::string &name : names) {
+      configs.emplace_back(CTISessionConfig{
+          name, std::string{base_section} + "." + name, 0, 0});
+    }
+
+    const IOLoop *io_loop = IOLoop::getInstance();
+    for (std::size_t i = 0; i < configs.size(); i++) {
+      configs[i].loop_index = io_loop->getSessionLoopIndex(i);
+    }
+
+    for (CTISessionConfig &config : configs) {
+      config.peripheral_id =
+          config.get("peripheral.id", static_cast<std::uint32_t>(5'000));
+    }
+
+    return configs;
+  }
+};
+} // namespace ctm
+
+#endif
@@ -8,13 +8,13 @@
 #include "./acceptor/tcp_acceptor.hpp"
 #include "./acceptor/websocket_acceptor.hpp"
 #include "./bridge/message_bridge.hpp"
-#include "./client_state.hpp"
-#include "./cti_client.h"
+#include "./cti_session.h"
+#include "./cti_session_config.hpp"
 
-#include <chrono>
 #include <memory>
 #include <spdlog/spdlog.h>
-#include <thread>
+#include <string>
+#include <vector>
 
 using namespace std;
 using namespace channel::event;
@@ -30,9 +30,24 @@ CTM::CTM() {
 
   bridge::MessageBridge::getInstance();
 
-  // CTI Client 생성 및 접속
-  cti_client = make_unique<CTIClient>();
-  cti_client->connect();
+  const util::IniLoader *ini_loader = util::IniLoader::getInstance();
+
+  if (ini_loader->get("replay", "replay.enabled", false)) {
+    // 라이브 CG 대신 캡처 파일을 재생한다 (첫 세션의 Peripheral 로 본다)
+    cti_replayer = make_unique<capture::CTIReplayer>(
+        ini_loader->get("replay", "replay.file", "./capture/cti.cap"s),
+        ini_loader->get("replay", "replay.speed", 1.0),
+        CTISessionConfig::loadAll().front().peripheral_id);
+    cti_replayer->start();
+  } else {
+    // 세션마다 자기 I/O 루프에서 수신하고 자기 스레드에서 디코딩한다
+    for (const CTISessionConfig &config : CTISessionConfig::loadAll()) {
+      cti_sessions.emplace_back(make_unique<CTISession>(config));
+    }
+    for (unique_ptr<CTISession> &cti_session : cti_sessions) {
+      cti_session->start();
+    }
+  }
 
   if (util::IniLoader::getInstance()->get("server", "tcp.enabled", false)) {
     acceptors.emplace_back(make_unique<acceptor::TCPAcceptor>());
@@ -70,30 +85,26 @@ void CTM::handleEvent(const Event *event) {
   case ::EventType::ERROR_EVENT:
     // 오류 이벤트
     switch (dynamic_cast<const ErrorEvent *>(event)->getErrorType()) {
-    case ErrorType::CTI_ERROR:
+    case ErrorType::CTI_ERROR: {
       // CTI 오류
-      dynamic_cast<const CTIErrorEvent *>(event)->getCTIErrorType();
-      dynamic_cast<const CTIErrorEvent *>(event)->getErrorHost();
+      const CTIErrorEvent *cti_error_event =
+          dynamic_cast<const CTIErrorEvent *>(event);
 
-      spdlog::warn(
-          "CTI Error notified. error_host: {}, error_type: {}",
-          dynamic_cast<const CTIErrorEvent *>(event)->getErrorHost(),
-          static_cast<std::uint32_t>(
-              dynamic_cast<const CTIErrorEvent *>(event)->getCTIErrorType()));
+      spdlog::warn("CTI Error notified. session: {}, error_host: {}, "
+                   "error_type: {}",
+                   cti_error_event->getSessionName(),
+                   cti_error_event->getErrorHost(),
+                   static_cast<std::uint32_t>(
+                       cti_error_event->getCTIErrorType()));
 
-      // 이중화 절체
-      ClientState::getInstance()->toggleActive();
-
-      // CG는 곧바로 SideB로 절체되지 않는다
-      // 내부적인 동기화 작업에 일정 시간이 소요됨으로 인해
-      // 스레드 sleep 코드를 추가하였다
-      // 안전하지 않음. 유의바람.
-      this_thread::sleep_for(chrono::milliseconds{500});
-
-      // CTI Client 재생성
-      cti_client = make_unique<CTIClient>();
-      cti_client->connect();
-      break;
+      // 오류가 난 세션만 재접속하거나 절체한다
+      for (unique_ptr<CTISession> &cti_session : cti_sessions) {
+        if (cti_session->getName() == cti_error_event->getSessionName()) {
+          cti_session->handleError(*cti_error_event);
+          break;
+        }
+      }
+    } break;
     case ErrorType::INTERNAL_ERROR:
       // 내부 오류
       break;
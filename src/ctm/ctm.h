@@ -5,7 +5,8 @@
 
 #include "../channel/subscriber.hpp"
 #include "./acceptor/acceptor.hpp"
-#include "./cti_client.h"
+#include "./capture/cti_replayer.h"
+#include "./cti_session.h"
 
 #include <memory>
 #include <vector>
@@ -41,7 +42,9 @@ public:
 
 protected:
 private:
-  std::unique_ptr<CTIClient> cti_client;
+  // 설정된 Peripheral (또는 CG 이중화 쌍) 마다 하나
+  std::vector<std::unique_ptr<CTISession>> cti_sessions;
+  std::unique_ptr<capture::CTIReplayer> cti_replayer;
   std::vector<std::unique_ptr<acceptor::Acceptor>> acceptors;
 };
 } // namespace ctm
@@ -119,13 +119,12 @@ public:
             : client_socket->remote_endpoint().address().to_string());
 
     // 최초 접속 시, 전체 상담원 상태를 바이너리 메시지로 전송
-    for (const std::pair<std::string, AgentInfo> &element :
-         AgentInfoMap::getInstance()->get()) {
+    for (const AgentInfo &agent_info :
+         AgentInfoMap::getInstance()->snapshot()) {
       if (ssl_enabled) {
-        co_await ssl_socket->async_write_some(
-            asio::buffer(element.second.pack()));
+        co_await ssl_socket->async_write_some(asio::buffer(agent_info.pack()));
       } else {
-        co_await client_socket->async_send(asio::buffer(element.second.pack()));
+        co_await client_socket->async_send(asio::buffer(agent_info.pack()));
       }
     }
 
@@ -263,9 +263,9 @@ protected:
     setSwitched(true);
 
     // 최초 접속 시, 전체 상담원 상태를 바이너리 메시지로 전송
-    for (const std::pair<std::string, AgentInfo> &element :
-         AgentInfoMap::getInstance()->get()) {
-      sendBinary(element.second.pack());
+    for (const AgentInfo &agent_info :
+         AgentInfoMap::getInstance()->snapshot()) {
+      sendBinary(agent_info.pack());
     }
   }
 
@@ -0,0 +1,165 @@
+#pragma once
+
+#ifndef _CTM_CTM_HEARTBEAT_MONITOR_HPP_
+#define _CTM_CTM_HEARTBEAT_MONITOR_HPP_
+
+#include "../util/latency_histogram.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <optional>
+
+namespace ctm {
+/**
+ * @brief HEARTBEAT_REQ / HEARTBEAT_CONF 추적
+ *
+ * 송신 시각을 Invoke ID 별로 기록해 두고 HEARTBEAT_CONF 와 맞춰 왕복 시간을
+ * 히스토그램에 기록한다. 다음 주기가 올 때까지 응답이 없으면 누락으로 보고,
+ * 누락이 연속으로 max_missed 번 쌓이면 연결이 끊긴 것으로 판단한다.
+ * I/O 루프 스레드에서만 사용한다.
+ */
+class HeartbeatMonitor {
+public:
+  using clock = std::chrono::steady_clock;
+
+  /**
+   * @brief Construct a new Heartbeat Monitor object
+   *
+   * @param interval 송신 주기 (응답 대기 시간)
+   * @param max_missed 연결 끊김으로 판단할 연속 누락 수
+   */
+  HeartbeatMonitor(const std::chrono::milliseconds interval,
+                   const std::size_t max_missed)
+      : interval{interval}, max_missed{std::max<std::size_t>(max_missed, 1)} {}
+
+  /**
+   * @brief Destroy the Heartbeat Monitor object
+   *
+   */
+  ~HeartbeatMonitor() = default;
+
+  /**
+   * @brief 새 연결에서 추적을 다시 시작 (첫 송신은 바로)
+   *
+   * @param now
+   */
+  void reset(const clock::time_point now) {
+    outstanding.clear();
+    next_send = now;
+    consecutive_missed = 0;
+  }
+
+  /**
+   * @brief 송신할 때가 되었는지 판단
+   *
+   * @param now
+   * @return true
+   * @return false
+   */
+  bool isDue(const clock::time_point now) const { return now >= next_send; }
+
+  /**
+   * @brief HEARTBEAT_REQ 송신 기록
+   *
+   * @param invoke_id
+   * @param now
+   */
+  void onSent(const std::uint32_t invoke_id, const clock::time_point now) {
+    outstanding.emplace_back(Outstanding{invoke_id, now});
+    next_send = now + interval;
+  }
+
+  /**
+   * @brief HEARTBEAT_CONF 수신 기록
+   *
+   * @param invoke_id
+   * @param now
+   * @return std::optional<clock::duration> 대기 중인 요청이 아니면 std::nullopt
+   */
+  std::optional<clock::duration> onConf(const std::uint32_t invoke_id,
+                                        const clock::time_point now) {
+    const auto iter = std::find_if(
+        outstanding.begin(), outstanding.end(),
+        [&](const Outstanding &o) { return o.invoke_id == invoke_id; });
+    if (iter == outstanding.end()) {
+      return std::nullopt;
+    }
+
+    const clock::duration round_trip = now - iter->sent;
+    outstanding.erase(iter);
+    consecutive_missed = 0;
+    round_trip_histogram.record(round_trip);
+
+    return round_trip;
+  }
+
+  /**
+   * @brief 응답 대기 시간이 지난 요청을 누락으로 처리
+   *
+   * @param now
+   * @return std::size_t 이번에 누락 처리된 수
+   */
+  std::size_t expire(const clock::time_point now) {
+    std::size_t expired = 0;
+    while (!outstanding.empty() && now - outstanding.front().sent >= interval) {
+      outstanding.pop_front();
+      expired++;
+    }
+
+    consecutive_missed += expired;
+    total_missed += expired;
+
+    return expired;
+  }
+
+  /**
+   * @brief 연속 누락으로 연결이 끊긴 것으로 판단되는지
+   *
+   * @return true
+   * @return false
+   */
+  bool isDead() const { return consecutive_missed >= max_missed; }
+
+  /**
+   * @brief 연속 누락 수
+   *
+   * @return std::size_t
+   */
+  std::size_t getConsecutiveMissed() const { return consecutive_missed; }
+  /**
+   * @brief 전체 누락 수
+   *
+   * @return std::uint64_t
+   */
+  std::uint64_t getTotalMissed() const { return total_missed; }
+  /**
+   * @brief 왕복 시간 히스토그램
+   *
+   * @return const util::LatencyHistogram&
+   */
+  const util::LatencyHistogram &getRoundTripHistogram() const {
+    return round_trip_histogram;
+  }
+
+protected:
+private:
+  struct Outstanding {
+    std::uint32_t invoke_id;
+    clock::time_point sent;
+  };
+
+  std::chrono::milliseconds interval;
+  std::size_t max_missed;
+
+  std::deque<Outstanding> outstanding{};
+  clock::time_point next_send{};
+  std::size_t consecutive_missed{0};
+  std::uint64_t total_missed{0};
+  util::LatencyHistogram round_trip_histogram{};
+};
+} // namespace ctm
+
+#endif
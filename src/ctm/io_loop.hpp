@@ -0,0 +1,138 @@
+#pragma once
+
+#ifndef _CTM_CTM_IO_LOOP_HPP_
+#define _CTM_CTM_IO_LOOP_HPP_
+
+/*
+  공유 I/O 루프 (루프마다 스레드 하나)
+  +-------------------+   +-----------------+   +-----------------+
+  | loop 0            |   | loop 1          |   | loop 2          |
+  | TCPAcceptor       |   | CTIClient (pg1) |   | CTIClient (pg2) |
+  | WebsocketAcceptor |   |                 |   |                 |
+  +-------------------+   +-----------------+   +-----------------+
+  클라이언트 접속은 0 번 루프에서, CTI 세션은 세션마다 정해진 루프에서
+  처리한다. 세션은 1 번 루프부터 나눠 맡고, 루프 수보다 많으면 1 번 루프로
+  돌아간다 (루프가 하나뿐이면 0 번 루프를 같이 쓴다). 한 루프에서 실행되는
+  코루틴끼리는 잠금 없이 상태를 나눈다.
+*/
+
+#include "../template/singleton.hpp"
+#include "../util/ini_loader.h"
+
+#include <asio/executor_work_guard.hpp>
+#include <asio/io_context.hpp>
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace ctm {
+class IOLoop : public tmpl::Singleton<IOLoop> {
+public:
+  /**
+   * @brief Construct a new IOLoop object (루프 스레드들을 바로 시작한다)
+   *
+   * 루프 수는 [server] io.threads (0 이면 코어 수) 를 따른다.
+   */
+  IOLoop() {
+    const std::size_t configured_count = static_cast<std::size_t>(
+        util::IniLoader::getInstance()->get("server", "io.threads", 0));
+    const std::size_t thread_count = std::max<std::size_t>(
+        configured_count != 0 ? configured_count
+                              : std::thread::hardware_concurrency(),
+        1);
+
+    for (std::size_t i = 0; i < thread_count; i++) {
+      loops.emplace_back(std::make_unique<Loop>());
+    }
+
+    spdlog::info("IO loops started. thread_count: {}", thread_count);
+  }
+
+  /**
+   * @brief Destroy the IOLoop object
+   *
+   */
+  virtual ~IOLoop() = default;
+
+  IOLoop(const IOLoop &) = delete;
+  IOLoop &operator=(const IOLoop &) = delete;
+
+  /**
+   * @brief 공유 io_context
+   *
+   * @param index 루프 번호 (루프 수로 나눈 나머지를 쓴다)
+   * @return asio::io_context&
+   */
+  asio::io_context &getContext(const std::size_t index = 0) {
+    return loops[index % loops.size()]->io_context;
+  }
+
+  /**
+   * @brief 세션이 맡을 루프 번호 (0 번 루프를 피해 1 번부터 돌아가며 고른다)
+   *
+   * @param session_index 설정된 세션 순서 (0 부터)
+   * @return std::size_t 루프가 하나뿐이면 0
+   */
+  std::size_t getSessionLoopIndex(const std::size_t session_index) const {
+    if (loops.size() <= 1) {
+      return 0;
+    }
+    return 1 + session_index % (loops.size() - 1);
+  }
+
+  /**
+   * @brief 루프 수
+   *
+   * @return std::size_t
+   */
+  std::size_t size() const { return loops.size(); }
+
+protected:
+private:
+  /**
+   * @brief io_context 하나와 그 루프 스레드
+   *
+   */
+  struct Loop {
+    Loop()
+        : work_guard{asio::make_work_guard(io_context)},
+          loop_thread{[this]() { run(); }} {}
+
+    ~Loop() {
+      work_guard.reset();
+      io_context.stop();
+      loop_thread.join();
+    }
+
+    /**
+     * @brief 루프 스레드 (핸들러에서 빠져나온 예외가 루프를 멈추지 않게
+     * 한다)
+     *
+     */
+    void run() {
+      while (true) {
+        try {
+          io_context.run();
+          return;
+        } catch (const std::exception &e) {
+          spdlog::error("Unhandled exception in IO loop. reason: {}",
+                        e.what());
+        }
+      }
+    }
+
+    asio::io_context io_context{1};
+    asio::executor_work_guard<asio::io_context::executor_type> work_guard;
+    std::thread loop_thread;
+  };
+
+  std::vector<std::unique_ptr<Loop>> loops{};
+};
+} // namespace ctm
+
+#endif
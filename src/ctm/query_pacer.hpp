@@ -0,0 +1,302 @@
+#pragma once
+
+#ifndef _CTM_CTM_QUERY_PACER_HPP_
+#define _CTM_CTM_QUERY_PACER_HPP_
+
+/*
+  상담원 상태 조회 송신 조절
+                +---------------------+
+  push() -----> | first query (FIFO)  | --+
+           |    +---------------------+   |    token bucket
+           |    +---------------------+   +--> + in-flight cap --> take()
+           +--> | re-query (FIFO)     | --+
+                +---------------------+
+  팀 구성 이벤트로 수천 건이 한꺼번에 들어와도 CG 에는 정해진 속도와 동시
+  요청 수 안에서만 보낸다. 한 번도 조회하지 않은 상담원을 먼저 보낸다.
+  같은 (peripheral, agent) 조회가 대기열이나 응답 대기 중에 있으면 새로
+  보내지 않고 기존 요청에 합친다. 응답 하나가 상담원 맵을 갱신하고 모든
+  클라이언트에 배포되므로 합친 요청도 함께 처리된다.
+*/
+
+#include "../util/token_bucket.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace ctm {
+class QueryPacer {
+public:
+  using clock = util::TokenBucket::clock;
+
+  /**
+   * @brief 상담원 상태 조회 요청
+   *
+   */
+  struct AgentQuery {
+    std::uint32_t peripheral_id;
+    std::string agent_id;
+  };
+
+  /**
+   * @brief Construct a new Query Pacer object
+   *
+   * @param rate 초당 최대 송신 수 (0 이하면 제한 없음)
+   * @param burst 한 번에 몰아서 보낼 수 있는 최대 수
+   * @param max_in_flight 응답을 기다리는 최대 요청 수 (0 이면 제한 없음)
+   */
+  QueryPacer(const double rate, const double burst,
+             const std::size_t max_in_flight)
+      : token_bucket{rate, burst}, max_in_flight{max_in_flight} {}
+
+  /**
+   * @brief Destroy the Query Pacer object
+   *
+   */
+  ~QueryPacer() = default;
+
+  QueryPacer(const QueryPacer &) = delete;
+  QueryPacer &operator=(const QueryPacer &) = delete;
+
+  /**
+   * @brief 송신 속도와 동시 요청 상한 변경
+   *
+   * @param rate
+   * @param burst
+   * @param max_in_flight
+   */
+  void configure(const double rate, const double burst,
+                 const std::size_t max_in_flight) {
+    std::lock_guard<std::mutex> lock{mutex};
+    token_bucket = util::TokenBucket{rate, burst};
+    this->max_in_flight = max_in_flight;
+  }
+
+  /**
+   * @brief 조회 요청을 대기열에 넣는다 (모든 스레드)
+   *
+   * @param query
+   * @return true 새 요청으로 대기열에 들어감
+   * @return false 대기 중이거나 응답을 기다리는 같은 조회에 합쳐짐
+   */
+  bool push(AgentQuery query) {
+    std::lock_guard<std::mutex> lock{mutex};
+
+    AgentEntry &agent = agents.try_emplace(keyOf(query), query).first->second;
+    if (agent.interest != 0) {
+      agent.interest++;
+      folded_count++;
+      return false;
+    }
+
+    agent.interest = 1;
+    if (agent.is_queried) {
+      requery_queue.emplace_back(std::move(query));
+    } else {
+      first_query_queue.emplace_back(std::move(query));
+    }
+
+    return true;
+  }
+
+  /**
+   * @brief 지금까지 들어온 모든 상담원을 다시 조회한다 (모든 스레드)
+   *
+   * 대기열이나 응답 대기 중인 상담원은 기존 요청에 합친다.
+   *
+   * @return std::size_t 새로 대기열에 넣은 수
+   */
+  std::size_t requeueAll() {
+    std::lock_guard<std::mutex> lock{mutex};
+
+    std::size_t queued = 0;
+    for (auto &[key, agent] : agents) {
+      if (agent.interest != 0) {
+        continue;
+      }
+
+      agent.interest = 1;
+      (agent.is_queried ? requery_queue : first_query_queue)
+          .emplace_back(agent.query);
+      queued++;
+    }
+
+    return queued;
+  }
+
+  /**
+   * @brief 지금까지 들어온 모든 상담원
+   *
+   * @return std::vector<AgentQuery>
+   */
+  std::vector<AgentQuery> getKnownAgents() const {
+    std::lock_guard<std::mutex> lock{mutex};
+
+    std::vector<AgentQuery> known_agents{};
+    known_agents.reserve(agents.size());
+    for (const auto &[key, agent] : agents) {
+      known_agents.emplace_back(agent.query);
+    }
+
+    return known_agents;
+  }
+
+  /**
+   * @brief 지금 보낼 수 있는 만큼 조회 요청을 꺼낸다 (송신 스레드)
+   *
+   * 꺼낸 요청은 응답 대기 중으로 세며, 보낸 뒤 onSent() 로 Invoke ID 를
+   * 알려야 한다.
+   *
+   * @param now
+   * @param batch 꺼낸 요청 (기존 내용은 지운다)
+   * @return std::size_t 꺼낸 수
+   */
+  std::size_t take(const clock::time_point now,
+                   std::vector<AgentQuery> &batch) {
+    batch.clear();
+
+    std::lock_guard<std::mutex> lock{mutex};
+    token_bucket.refill(now);
+
+    while (!first_query_queue.empty() || !requery_queue.empty()) {
+      if (max_in_flight != 0 && in_flight >= max_in_flight) {
+        break;
+      }
+      if (!token_bucket.tryTake()) {
+        break;
+      }
+
+      std::deque<AgentQuery> &queue =
+          first_query_queue.empty() ? requery_queue : first_query_queue;
+      agents.at(keyOf(queue.front())).is_queried = true;
+      batch.emplace_back(std::move(queue.front()));
+      queue.pop_front();
+      in_flight++;
+    }
+
+    return batch.size();
+  }
+
+  /**
+   * @brief take() 로 꺼낸 요청을 보낸 Invoke ID 기록 (송신 스레드)
+   *
+   * @param invoke_id
+   * @param query
+   */
+  void onSent(const std::uint32_t invoke_id, const AgentQuery &query) {
+    std::lock_guard<std::mutex> lock{mutex};
+    in_flight_keys.insert_or_assign(invoke_id, keyOf(query));
+  }
+
+  /**
+   * @brief 응답을 받았거나 포기한 요청 반영 (송신 스레드)
+   *
+   * @param invoke_id
+   * @return std::uint32_t 이 요청에 합쳐져 있던 조회 수 (조회 요청이
+   *         아니면 0)
+   */
+  std::uint32_t onFinished(const std::uint32_t invoke_id) {
+    std::lock_guard<std::mutex> lock{mutex};
+
+    const auto iter = in_flight_keys.find(invoke_id);
+    if (iter == in_flight_keys.end()) {
+      return 0;
+    }
+
+    AgentEntry &agent = agents.at(iter->second);
+    const std::uint32_t interest = agent.interest;
+    agent.interest = 0;
+    in_flight_keys.erase(iter);
+    if (in_flight != 0) {
+      in_flight--;
+    }
+
+    return interest;
+  }
+
+  /**
+   * @brief 연결이 바뀌었을 때 대기열과 응답 대기 수를 비운다
+   *
+   * 들어온 상담원 목록과 조회 여부는 유지한다.
+   */
+  void reset() {
+    std::lock_guard<std::mutex> lock{mutex};
+    first_query_queue.clear();
+    requery_queue.clear();
+    for (auto &[key, agent] : agents) {
+      agent.interest = 0;
+    }
+    in_flight_keys.clear();
+    in_flight = 0;
+    token_bucket.reset();
+  }
+
+  /**
+   * @brief 아직 보내지 않은 조회 요청 수
+   *
+   * @return std::size_t
+   */
+  std::size_t getQueuedCount() const {
+    std::lock_guard<std::mutex> lock{mutex};
+    return first_query_queue.size() + requery_queue.size();
+  }
+
+  /**
+   * @brief 응답을 기다리는 조회 요청 수
+   *
+   * @return std::size_t
+   */
+  std::size_t getInFlightCount() const {
+    std::lock_guard<std::mutex> lock{mutex};
+    return in_flight;
+  }
+
+  /**
+   * @brief 기존 요청에 합쳐진 조회 수 (누적)
+   *
+   * @return std::uint64_t
+   */
+  std::uint64_t getFoldedCount() const {
+    std::lock_guard<std::mutex> lock{mutex};
+    return folded_count;
+  }
+
+protected:
+private:
+  /**
+   * @brief 들어온 적 있는 상담원
+   *
+   */
+  struct AgentEntry {
+    explicit AgentEntry(const AgentQuery &query) : query{query} {}
+
+    AgentQuery query;
+    bool is_queried{false};    // 한 번이라도 보냈는지
+    std::uint32_t interest{0}; // 대기열 또는 응답 대기 중인 조회 수
+  };
+
+  static std::string keyOf(const AgentQuery &query) {
+    return std::to_string(query.peripheral_id) + "-" + query.agent_id;
+  }
+
+  mutable std::mutex mutex{};
+  util::TokenBucket token_bucket;
+  std::size_t max_in_flight;
+  std::size_t in_flight{0};
+
+  std::deque<AgentQuery> first_query_queue{};
+  std::deque<AgentQuery> requery_queue{};
+  // peripheral-agent -> 상담원
+  std::unordered_map<std::string, AgentEntry> agents{};
+  std::unordered_map<std::uint32_t, std::string> in_flight_keys{};
+  std::uint64_t folded_count{0};
+};
+} // namespace ctm
+
+#endif
@@ -0,0 +1,207 @@
+#pragma once
+
+#ifndef _CTM_CTM_RECONNECT_SCHEDULER_HPP_
+#define _CTM_CTM_RECONNECT_SCHEDULER_HPP_
+
+/*
+  재접속 스케줄러
+                  schedule()                 기한 도달
+  +------+  ----------------->  +---------+  ---------->  +------------+
+  | IDLE |                      | WAITING |               | ATTEMPTING |
+  +------+  <-----------------  +---------+  <----------  +------------+
+                  성공                           실패 (retry_count++)
+  대기 시간 = min(max_delay, initial_delay * 2^retry_count) * (1 - jitter * U)
+  (U 는 [0, 1) 난수). 여러 프로세스가 같은 시각에 끊겨도 재접속 시각이 흩어진다.
+  접속 시도는 스케줄러 스레드에서 실행되므로 이벤트 채널 스레드를 막지 않는다.
+*/
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <utility>
+
+namespace ctm {
+class ReconnectScheduler {
+public:
+  using clock = std::chrono::steady_clock;
+
+  /**
+   * @brief 재접속 대기 시간 정책
+   *
+   */
+  struct Policy {
+    std::chrono::milliseconds initial_delay{500};
+    std::chrono::milliseconds max_delay{30'000};
+    double jitter{0.2}; // 0 ~ 1
+  };
+
+  /**
+   * @brief Construct a new Reconnect Scheduler object
+   *
+   * @param policy
+   * @param attempt 접속을 시도하고 성공 여부를 반환 (스케줄러 스레드에서 호출)
+   */
+  ReconnectScheduler(const Policy &policy, std::function<bool()> attempt)
+      : policy{policy}, attempt{std::move(attempt)},
+        random_engine{std::random_device{}()},
+        worker{[this]() { run(); }} {}
+
+  /**
+   * @brief Destroy the Reconnect Scheduler object
+   *
+   */
+  ~ReconnectScheduler() {
+    {
+      std::lock_guard<std::mutex> lock{mutex};
+      state = State::STOPPED;
+    }
+    condition.notify_all();
+    worker.join();
+  }
+
+  ReconnectScheduler(const ReconnectScheduler &) = delete;
+  ReconnectScheduler &operator=(const ReconnectScheduler &) = delete;
+
+  /**
+   * @brief 재접속 예약 (모든 스레드, 바로 반환)
+   *
+   * 이미 예약되어 있거나 시도 중이면 아무것도 하지 않는다.
+   *
+   * @return true 새로 예약됨
+   * @return false 이미 진행 중
+   */
+  bool schedule() {
+    {
+      std::lock_guard<std::mutex> lock{mutex};
+      if (state != State::IDLE) {
+        return false;
+      }
+
+      deadline = clock::now() + nextDelay();
+      state = State::WAITING;
+    }
+    condition.notify_all();
+
+    return true;
+  }
+
+  /**
+   * @brief 예약 취소 (시도 중인 접속은 끝까지 진행된다)
+   *
+   */
+  void cancel() {
+    std::lock_guard<std::mutex> lock{mutex};
+    if (state == State::WAITING) {
+      state = State::IDLE;
+    }
+  }
+
+  /**
+   * @brief 연속 실패 횟수
+   *
+   * @return std::uint32_t
+   */
+  std::uint32_t getRetryCount() const {
+    std::lock_guard<std::mutex> lock{mutex};
+    return retry_count;
+  }
+
+  /**
+   * @brief 지터를 뺀 대기 시간
+   *
+   * @param policy
+   * @param retry_count
+   * @return std::chrono::milliseconds
+   */
+  static std::chrono::milliseconds
+  backoffOf(const Policy &policy, const std::uint32_t retry_count) {
+    // 2^16 배 이상은 어차피 최대 대기 시간을 넘는다
+    const std::chrono::milliseconds delay =
+        policy.initial_delay * (std::int64_t{1} << std::min(retry_count, 16u));
+    return std::min(delay, policy.max_delay);
+  }
+
+protected:
+private:
+  enum class State {
+    IDLE,
+    WAITING,
+    ATTEMPTING,
+    STOPPED,
+  };
+
+  /**
+   * @brief 지터를 더한 다음 대기 시간 (잠금을 잡고 호출)
+   *
+   * @return std::chrono::milliseconds
+   */
+  std::chrono::milliseconds nextDelay() {
+    const std::chrono::milliseconds backoff = backoffOf(policy, retry_count);
+    const double jitter = std::clamp(policy.jitter, 0.0, 1.0);
+    std::uniform_real_distribution<double> distribution{0.0, jitter};
+
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+        backoff * (1.0 - distribution(random_engine)));
+  }
+
+  /**
+   * @brief 스케줄러 스레드
+   *
+   */
+  void run() {
+    std::unique_lock<std::mutex> lock{mutex};
+    while (state != State::STOPPED) {
+      if (state != State::WAITING) {
+        condition.wait(lock);
+        continue;
+      }
+
+      if (condition.wait_until(lock, deadline) == std::cv_status::no_timeout) {
+        // 취소, 종료, 또는 가짜 깨어남
+        continue;
+      }
+      if (state != State::WAITING) {
+        continue;
+      }
+
+      state = State::ATTEMPTING;
+      lock.unlock();
+      const bool connected = attempt();
+      lock.lock();
+
+      if (state == State::STOPPED) {
+        break;
+      }
+
+      if (connected) {
+        retry_count = 0;
+        state = State::IDLE;
+        continue;
+      }
+
+      retry_count++;
+      deadline = clock::now() + nextDelay();
+      state = State::WAITING;
+    }
+  }
+
+  Policy policy;
+  std::function<bool()> attempt;
+
+  mutable std::mutex mutex{};
+  std::condition_variable condition{};
+  State state{State::IDLE};
+  clock::time_point deadline{};
+  std::uint32_t retry_count{0};
+  std::mt19937 random_engine;
+
+  std::thread worker;
+};
+} // namespace ctm
+
+#endif
@@ -0,0 +1,330 @@
+#pragma once
+
+#ifndef _CTM_CTM_REQUEST_TABLE_HPP_
+#define _CTM_CTM_REQUEST_TABLE_HPP_
+
+/*
+  응답 대기 요청 테이블 (Invoke ID 를 키로 하는 오픈 어드레싱, 선형 탐사)
+  +------+------+------+------+------+------+------+------+
+  | id 8 |      | id 2 | id 3 | id 11|      |      | id 7 |
+  +------+------+------+------+------+------+------+------+
+  slot = invoke_id & (capacity - 1)
+  Invoke ID 는 순서대로 증가하므로 해시 없이 하위 비트만으로 고르게 퍼진다.
+  삭제 시에는 뒤따르는 슬롯을 당겨 와서 탐사 사슬이 끊기지 않게 한다.
+*/
+
+#include "../cisco/common/message_type.hpp"
+#include "../util/latency_histogram.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace ctm {
+class RequestTable {
+public:
+  using clock = std::chrono::steady_clock;
+
+  /**
+   * @brief 응답 대기 중인 요청
+   *
+   */
+  struct Request {
+    std::uint32_t invoke_id;
+    cisco::common::MessageType message_type;
+    clock::time_point sent;     // 마지막 송신 시각
+    clock::time_point deadline; // 응답 대기 기한
+    std::uint32_t retry_count;  // 재전송 횟수
+    std::uint32_t retry_limit;  // 재전송할 최대 횟수
+    std::vector<std::byte> packet;
+  };
+
+  /**
+   * @brief 응답이 도착한 요청
+   *
+   */
+  struct Completion {
+    cisco::common::MessageType message_type;
+    clock::duration latency; // 마지막 송신부터 응답까지
+    std::uint32_t retry_count;
+  };
+
+  /**
+   * @brief 메시지 유형별 통계
+   *
+   */
+  struct Stats {
+    util::LatencyHistogram latency{};
+    std::uint64_t retried{0};
+    std::uint64_t timed_out{0};
+  };
+
+  /**
+   * @brief Construct a new Request Table object
+   *
+   * @param timeout 요청 하나의 응답 대기 시간
+   * @param max_retry_count 응답이 없을 때 재전송할 최대 횟수
+   * @param initial_capacity 초기 슬롯 수 (2 의 거듭제곱으로 올림)
+   */
+  RequestTable(const std::chrono::milliseconds timeout,
+               const std::uint32_t max_retry_count,
+               const std::size_t initial_capacity = 1'024)
+      : timeout{timeout}, max_retry_count{max_retry_count},
+        slots(std::bit_ceil(std::max<std::size_t>(initial_capacity, 16))) {}
+
+  /**
+   * @brief Destroy the Request Table object
+   *
+   */
+  ~RequestTable() = default;
+
+  RequestTable(const RequestTable &) = delete;
+  RequestTable &operator=(const RequestTable &) = delete;
+
+  /**
+   * @brief 응답 대기 시간과 재전송 횟수 변경 (대기 중인 요청은 그대로)
+   *
+   * @param timeout
+   * @param max_retry_count
+   */
+  void configure(const std::chrono::milliseconds timeout,
+                 const std::uint32_t max_retry_count) {
+    std::lock_guard<std::mutex> lock{mutex};
+    this->timeout = timeout;
+    this->max_retry_count = max_retry_count;
+  }
+
+  /**
+   * @brief 송신한 요청 등록 (송신 대기열에 넣기 전에 호출)
+   *
+   * @param invoke_id
+   * @param message_type
+   * @param packet 재전송에 쓸 직렬화된 요청
+   * @param now
+   * @param is_retryable false 면 기한이 지났을 때 재전송하지 않고 바로 포기
+   * @return true
+   * @return false 같은 Invoke ID 가 이미 대기 중
+   */
+  bool insert(const std::uint32_t invoke_id,
+              const cisco::common::MessageType message_type,
+              const std::span<const std::byte> packet,
+              const clock::time_point now, const bool is_retryable = true) {
+    std::lock_guard<std::mutex> lock{mutex};
+
+    // 부하율을 1/2 이하로 유지해야 탐사 사슬이 짧다
+    if ((count + 1) * 2 > slots.size()) {
+      grow();
+    }
+
+    std::size_t index = slotOf(invoke_id);
+    for (; slots[index].has_value(); index = next(index)) {
+      if (slots[index]->invoke_id == invoke_id) {
+        return false;
+      }
+    }
+
+    slots[index].emplace(Request{invoke_id, message_type, now, now + timeout, 0,
+                                 is_retryable ? max_retry_count : 0,
+                                 {packet.begin(), packet.end()}});
+    count++;
+    next_deadline = std::min(next_deadline, now + timeout);
+
+    return true;
+  }
+
+  /**
+   * @brief 응답 수신 처리
+   *
+   * @param invoke_id
+   * @param now
+   * @return std::optional<Completion> 대기 중인 요청이 아니면 std::nullopt
+   */
+  std::optional<Completion> complete(const std::uint32_t invoke_id,
+                                     const clock::time_point now) {
+    std::lock_guard<std::mutex> lock{mutex};
+
+    const std::optional<std::size_t> index = find(invoke_id);
+    if (!index) {
+      return std::nullopt;
+    }
+
+    const Request &request = *slots[*index];
+    const Completion completion{request.message_type, now - request.sent,
+                                request.retry_count};
+    stats[completion.message_type].latency.record(completion.latency);
+    erase(*index);
+
+    return completion;
+  }
+
+  /**
+   * @brief 기한이 지난 요청을 재전송하거나 포기한다
+   *
+   * 콜백은 잠금을 잡은 채 호출되므로 테이블에 다시 접근하면 안 된다.
+   *
+   * @tparam Retry const Request & 를 받아 재전송
+   * @tparam Drop const Request & 를 받아 포기 처리
+   * @param now
+   * @param on_retry
+   * @param on_drop
+   */
+  template <typename Retry, typename Drop>
+  void expire(const clock::time_point now, Retry &&on_retry, Drop &&on_drop) {
+    std::lock_guard<std::mutex> lock{mutex};
+
+    if (count == 0 || now < next_deadline) {
+      return;
+    }
+
+    next_deadline = clock::time_point::max();
+    for (std::size_t index = 0; index < slots.size();) {
+      if (!slots[index].has_value()) {
+        index++;
+        continue;
+      }
+
+      Request &request = *slots[index];
+      if (now < request.deadline) {
+        next_deadline = std::min(next_deadline, request.deadline);
+        index++;
+        continue;
+      }
+
+      Stats &type_stats = stats[request.message_type];
+      if (request.retry_count < request.retry_limit) {
+        request.retry_count++;
+        request.sent = now;
+        request.deadline = now + timeout;
+        next_deadline = std::min(next_deadline, request.deadline);
+        type_stats.retried++;
+        on_retry(static_cast<const Request &>(request));
+        index++;
+        continue;
+      }
+
+      type_stats.timed_out++;
+      on_drop(static_cast<const Request &>(request));
+      // 뒤의 슬롯이 당겨져 올 수 있으므로 같은 위치를 다시 본다
+      erase(index);
+    }
+  }
+
+  /**
+   * @brief 연결이 바뀌었을 때 대기 중인 요청을 모두 버린다 (통계는 유지)
+   *
+   */
+  void clear() {
+    std::lock_guard<std::mutex> lock{mutex};
+    for (std::optional<Request> &slot : slots) {
+      slot.reset();
+    }
+    count = 0;
+    next_deadline = clock::time_point::min();
+  }
+
+  /**
+   * @brief 응답 대기 중인 요청 수
+   *
+   * @return std::size_t
+   */
+  std::size_t size() const {
+    std::lock_guard<std::mutex> lock{mutex};
+    return count;
+  }
+
+  /**
+   * @brief 메시지 유형별 통계 복사본
+   *
+   * @return std::map<cisco::common::MessageType, Stats>
+   */
+  std::map<cisco::common::MessageType, Stats> getStats() const {
+    std::lock_guard<std::mutex> lock{mutex};
+    return stats;
+  }
+
+protected:
+private:
+  std::size_t slotOf(const std::uint32_t invoke_id) const {
+    return invoke_id & (slots.size() - 1);
+  }
+
+  std::size_t next(const std::size_t index) const {
+    return (index + 1) & (slots.size() - 1);
+  }
+
+  std::optional<std::size_t> find(const std::uint32_t invoke_id) const {
+    for (std::size_t index = slotOf(invoke_id); slots[index].has_value();
+         index = next(index)) {
+      if (slots[index]->invoke_id == invoke_id) {
+        return index;
+      }
+    }
+
+    return std::nullopt;
+  }
+
+  /**
+   * @brief 슬롯을 비우고, 뒤따르는 사슬을 당겨 빈 칸을 메운다
+   *
+   * @param index
+   */
+  void erase(std::size_t index) {
+    slots[index].reset();
+    count--;
+
+    for (std::size_t cursor = next(index); slots[cursor].has_value();
+         cursor = next(cursor)) {
+      // 원래 자리가 (index, cursor] 사이에 있으면 당길 수 없다
+      const std::size_t home = slotOf(slots[cursor]->invoke_id);
+      const std::size_t mask = slots.size() - 1;
+      if (((cursor - home) & mask) < ((cursor - index) & mask)) {
+        continue;
+      }
+
+      slots[index] = std::move(slots[cursor]);
+      slots[cursor].reset();
+      index = cursor;
+    }
+  }
+
+  /**
+   * @brief 슬롯 수를 두 배로 늘리고 다시 배치
+   *
+   */
+  void grow() {
+    std::vector<std::optional<Request>> old_slots(slots.size() * 2);
+    std::swap(slots, old_slots);
+
+    for (std::optional<Request> &slot : old_slots) {
+      if (!slot.has_value()) {
+        continue;
+      }
+
+      std::size_t index = slotOf(slot->invoke_id);
+      while (slots[index].has_value()) {
+        index = next(index);
+      }
+      slots[index] = std::move(slot);
+    }
+  }
+
+  std::chrono::milliseconds timeout;
+  std::uint32_t max_retry_count;
+
+  mutable std::mutex mutex{};
+  std::vector<std::optional<Request>> slots;
+  std::size_t count{0};
+  clock::time_point next_deadline{clock::time_point::min()};
+  std::map<cisco::common::MessageType, Stats> stats{};
+};
+} // namespace ctm
+
+#endif
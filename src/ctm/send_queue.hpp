@@ -0,0 +1,173 @@
+#pragma once
+
+#ifndef _CTM_CTM_SEND_QUEUE_HPP_
+#define _CTM_CTM_SEND_QUEUE_HPP_
+
+/*
+  CTI 송신 대기열
+  +------------------------+         +----------------------------+
+  | Pending (producers)    |  swap   | Sending (writer only)      |
+  | packet | packet | ...  | ------> | sent | not yet sent        |
+  +------------------------+         +----------------------------+
+                                            ^ sent_offset
+  여러 스레드가 넣은 패킷을 버퍼 하나에 이어 붙이고, 송신은 한 스레드(쓰기
+  담당)만 한다. 쓰기 담당은 쌓인 패킷 전체를 한 번의 송신으로 보내고, 일부만
+  보내졌으면 남은 위치부터 다시 보낸다.
+*/
+
+#include <cstddef>
+#include <cstring>
+#include <mutex>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace ctm {
+class SendQueue {
+public:
+  /**
+   * @brief 패킷 추가 결과
+   *
+   */
+  enum class PushResult {
+    QUEUED,   // 이미 쓰기 담당이 동작 중
+    ARMED,    // 쓰기 담당을 새로 깨워야 함
+    OVERFLOW, // 대기열이 가득 차 버림
+  };
+
+  /**
+   * @brief 송신 결과
+   *
+   */
+  enum class FlushResult {
+    DRAINED, // 대기열을 모두 보냄
+    BLOCKED, // 소켓 송신 버퍼가 가득 참
+  };
+
+  /**
+   * @brief Construct a new Send Queue object
+   *
+   * @param max_pending_size 보내지 못하고 쌓아 둘 수 있는 최대 바이트
+   */
+  explicit SendQueue(const std::size_t max_pending_size = 4 * 1'024 * 1'024)
+      : max_pending_size{max_pending_size} {}
+
+  /**
+   * @brief Destroy the Send Queue object
+   *
+   */
+  ~SendQueue() = default;
+
+  SendQueue(const SendQueue &) = delete;
+  SendQueue &operator=(const SendQueue &) = delete;
+
+  /**
+   * @brief 패킷을 복사해 대기열 뒤에 붙인다 (모든 스레드)
+   *
+   * @param packet
+   * @return PushResult
+   */
+  PushResult push(const std::span<const std::byte> packet) {
+    std::lock_guard<std::mutex> lock{mutex};
+
+    if (pending.size() + packet.size() > max_pending_size) {
+      return PushResult::OVERFLOW;
+    }
+
+    const std::size_t position = pending.size();
+    pending.resize(position + packet.size());
+    std::memcpy(pending.data() + position, packet.data(), packet.size());
+
+    if (armed) {
+      return PushResult::QUEUED;
+    }
+
+    armed = true;
+    return PushResult::ARMED;
+  }
+
+  /**
+   * @brief 쌓인 패킷을 보낸다 (쓰기 담당 스레드)
+   *
+   * @tparam Send std::span<const std::byte> 를 받아 보낸 바이트 수를 반환
+   *              (더 보낼 수 없으면 0 이하)
+   * @param send
+   * @return FlushResult
+   */
+  template <typename Send> FlushResult flush(Send &&send) {
+    while (true) {
+      if (sent_offset == sending.size()) {
+        sending.clear();
+        sent_offset = 0;
+
+        std::lock_guard<std::mutex> lock{mutex};
+        if (pending.empty()) {
+          return FlushResult::DRAINED;
+        }
+        std::swap(pending, sending);
+      }
+
+      const auto length =
+          send(std::span<const std::byte>{sending}.subspan(sent_offset));
+      if (length <= 0) {
+        return FlushResult::BLOCKED;
+      }
+
+      sent_offset += static_cast<std::size_t>(length);
+    }
+  }
+
+  /**
+   * @brief 쓰기 담당을 내려놓는다 (쓰기 담당 스레드)
+   *
+   * flush() 가 DRAINED 를 반환하고 쓰기 통지를 해제한 뒤 호출한다.
+   *
+   * @return true 대기 상태로 전환됨
+   * @return false 그 사이 패킷이 들어와 계속 쓰기 담당을 유지해야 함
+   */
+  bool disarm() {
+    std::lock_guard<std::mutex> lock{mutex};
+    if (!pending.empty()) {
+      return false;
+    }
+
+    armed = false;
+    return true;
+  }
+
+  /**
+   * @brief 연결이 바뀌었을 때 보내지 못한 패킷을 버린다
+   *
+   */
+  void reset() {
+    std::lock_guard<std::mutex> lock{mutex};
+    pending.clear();
+    sending.clear();
+    sent_offset = 0;
+    armed = false;
+  }
+
+  /**
+   * @brief 아직 보내지 못한 바이트 수
+   *
+   * @return std::size_t
+   */
+  std::size_t getPendingSize() const {
+    std::lock_guard<std::mutex> lock{mutex};
+    return pending.size();
+  }
+
+protected:
+private:
+  std::size_t max_pending_size;
+
+  mutable std::mutex mutex{};
+  std::vector<std::byte> pending{};
+  bool armed{false};
+
+  std::vector<std::byte> sending{};
+  std::size_t sent_offset{0};
+};
+} // namespace ctm
+
+#endif
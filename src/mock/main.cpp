@@ -0,0 +1,31 @@
+#include "../util/ini_loader.h"
+#include "./mock_cg.hpp"
+
+#include <spdlog/common.h>
+#include <spdlog/spdlog.h>
+
+#include <cstdlib>
+#include <exception>
+#include <string>
+
+using namespace std;
+
+int main(int argc, char **argv) {
+  // INI 파일에서 로그 레벨 추출 (모의 CG 는 콘솔에만 출력한다)
+  const string level_string =
+      util::IniLoader::getInstance()->get("log", "log.level", string("info"));
+  spdlog::set_level(spdlog::level::from_str(level_string));
+  spdlog::set_pattern("[%5l][%Y-%m-%d %H:%M:%S.%e][mock_cg][%t] - %v");
+
+  // 모의 CG 실행
+  try {
+    mock::MockCG mock_cg{};
+    mock_cg.run();
+  } catch (const exception &e) {
+    spdlog::critical("Mock CG terminated. reason: {}", e.what());
+    return EXIT_FAILURE;
+  }
+
+  spdlog::shutdown();
+  return EXIT_SUCCESS;
+}
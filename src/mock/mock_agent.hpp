@@ -0,0 +1,174 @@
+#pragma once
+
+#ifndef _CTM_MOCK_MOCK_AGENT_HPP_
+#define _CTM_MOCK_MOCK_AGENT_HPP_
+
+#include "../cisco/common/agent_state_value.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace mock {
+/**
+ * @brief 가상 상담원
+ *
+ */
+struct MockAgent {
+  std::string agent_id;
+  std::string agent_extension;
+  std::int32_t icm_agent_id;
+  std::int32_t skill_group_number;
+  std::uint32_t skill_group_id;
+  cisco::common::AgentStateValue agent_state;
+  std::chrono::steady_clock::time_point state_changed;
+
+  /**
+   * @brief 현재 상태 유지 시간 (초)
+   *
+   * @return std::uint32_t
+   */
+  std::uint32_t getStateDuration() const {
+    return static_cast<std::uint32_t>(
+        std::chrono::duration_cast<std::chrono::seconds>(
+            std::chrono::steady_clock::now() - state_changed)
+            .count());
+  }
+};
+
+/**
+ * @brief 가상 상담원 목록
+ *
+ * 상담원은 팀 단위로 연속 배치되며, 상태 변경은 라운드 로빈으로 돌아가며
+ * 실제 콜센터의 상태 순환을 흉내낸다.
+ */
+class MockAgentPool {
+public:
+  /**
+   * @brief Construct a new Mock Agent Pool object
+   *
+   * @param number_of_agents
+   * @param team_size
+   */
+  MockAgentPool(const std::size_t number_of_agents, const std::size_t team_size)
+      : team_size{team_size == 0 ? 1 : team_size} {
+    const std::chrono::steady_clock::time_point now =
+        std::chrono::steady_clock::now();
+
+    agents.reserve(number_of_agents);
+    for (std::size_t i = 0; i < number_of_agents; i++) {
+      const std::size_t team = i / this->team_size;
+
+      agents.emplace_back(MockAgent{
+          std::to_string(10'000 + i), std::to_string(70'000 + i),
+          static_cast<std::int32_t>(5'000 + i),
+          static_cast<std::int32_t>(3'000 + team),
+          static_cast<std::uint32_t>(5'000 + team),
+          cisco::common::AgentStateValue::AGENT_STATE_AVAILABLE, now});
+      agent_index.emplace(agents.back().agent_id, i);
+    }
+  }
+
+  /**
+   * @brief Destroy the Mock Agent Pool object
+   *
+   */
+  ~MockAgentPool() = default;
+
+  /**
+   * @brief 상담원 수
+   *
+   * @return std::size_t
+   */
+  std::size_t size() const { return agents.size(); }
+  /**
+   * @brief 팀 수
+   *
+   * @return std::size_t
+   */
+  std::size_t getTeamCount() const {
+    return (agents.size() + team_size - 1) / team_size;
+  }
+
+  /**
+   * @brief 상담원 ID 로 조회
+   *
+   * @param agent_id
+   * @return const MockAgent*
+   */
+  const MockAgent *find(const std::string_view agent_id) const {
+    const auto iter = agent_index.find(std::string{agent_id});
+
+    return iter == agent_index.end() ? nullptr : &agents[iter->second];
+  }
+
+  /**
+   * @brief team 번째 팀의 상담원들
+   *
+   * @param team
+   * @return std::span<const MockAgent>
+   */
+  std::span<const MockAgent> getTeam(const std::size_t team) const {
+    const std::size_t begin = team * team_size;
+    if (begin >= agents.size()) {
+      return {};
+    }
+
+    return std::span<const MockAgent>{agents}.subspan(
+        begin, std::min(team_size, agents.size() - begin));
+  }
+
+  /**
+   * @brief 다음 상담원의 상태를 바꾸고 반환
+   *
+   * @return const MockAgent&
+   */
+  const MockAgent &advance() {
+    MockAgent &agent = agents[next_agent];
+    next_agent = (next_agent + 1) % agents.size();
+
+    agent.agent_state = nextState(agent.agent_state);
+    agent.state_changed = std::chrono::steady_clock::now();
+
+    return agent;
+  }
+
+protected:
+private:
+  /**
+   * @brief 상담원 상태 순환
+   * AVAILABLE -> TALKING -> WORK_READY -> NOT_READY -> AVAILABLE
+   *
+   * @param state
+   * @return cisco::common::AgentStateValue
+   */
+  static cisco::common::AgentStateValue
+  nextState(const cisco::common::AgentStateValue state) {
+    using cisco::common::AgentStateValue;
+
+    switch (state) {
+    case AgentStateValue::AGENT_STATE_AVAILABLE:
+      return AgentStateValue::AGENT_STATE_TALKING;
+    case AgentStateValue::AGENT_STATE_TALKING:
+      return AgentStateValue::AGENT_STATE_WORK_READY;
+    case AgentStateValue::AGENT_STATE_WORK_READY:
+      return AgentStateValue::AGENT_STATE_NOT_READY;
+    default:
+      return AgentStateValue::AGENT_STATE_AVAILABLE;
+    }
+  }
+
+  std::size_t team_size;
+  std::vector<MockAgent> agents{};
+  std::unordered_map<std::string, std::size_t> agent_index{};
+  std::size_t next_agent{0};
+};
+} // namespace mock
+
+#endif
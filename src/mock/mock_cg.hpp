@@ -0,0 +1,214 @@
+#pragma once
+
+#ifndef _CTM_MOCK_MOCK_CG_HPP_
+#define _CTM_MOCK_MOCK_CG_HPP_
+
+#include "../util/ini_loader.h"
+#include "./mock_agent.hpp"
+#include "./mock_session.hpp"
+
+#include <asio/awaitable.hpp>
+#include <asio/co_spawn.hpp>
+#include <asio/detached.hpp>
+#include <asio/error_code.hpp>
+#include <asio/io_context.hpp>
+#include <asio/ip/tcp.hpp>
+#include <asio/redirect_error.hpp>
+#include <asio/steady_timer.hpp>
+#include <asio/use_awaitable.hpp>
+#include <spdlog/spdlog.h>
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace mock {
+/**
+ * @brief GED-188 모의 CTI 서버 (CG)
+ *
+ * [cti] 의 side.a/side.b 평문 포트로 두 사이드를 열고, [mock] 설정에 따라
+ * 가상 상담원 이벤트를 발생시킨다. side A 장애를 시뮬레이션하면 A 의 세션을
+ * 모두 끊고 접속을 거부하므로, CTM 의 이중화 절체를 실험할 수 있다.
+ */
+class MockCG {
+public:
+  /**
+   * @brief Construct a new Mock CG object
+   *
+   */
+  MockCG()
+      : agent_pool{util::IniLoader::getInstance()->get("mock", "mock.agents",
+                                                       std::uint32_t{1'000}),
+                   util::IniLoader::getInstance()->get("mock", "mock.team.size",
+                                                       std::uint32_t{20})},
+        side_a_port{util::IniLoader::getInstance()->get(
+            "cti", "side.a.port.plain", std::uint16_t{42027})},
+        side_b_port{util::IniLoader::getInstance()->get(
+            "cti", "side.b.port.plain", std::uint16_t{43027})},
+        side_a_fail_after{util::IniLoader::getInstance()->get(
+            "mock", "mock.side.a.fail_after", std::uint32_t{0})},
+        side_a_down_for{util::IniLoader::getInstance()->get(
+            "mock", "mock.side.a.down_for", std::uint32_t{0})} {
+    const util::IniLoader *ini_loader = util::IniLoader::getInstance();
+
+    storm_config.peripheral_id =
+        ini_loader->get("mock", "mock.peripheral.id", std::uint32_t{5000});
+    storm_config.rate =
+        ini_loader->get("mock", "mock.storm.rate", std::uint32_t{0});
+    storm_config.delay = std::chrono::milliseconds{
+        ini_loader->get("mock", "mock.storm.delay", std::uint32_t{1'000})};
+    storm_config.agent_state_weight = ini_loader->get(
+        "mock", "mock.storm.agent_state.weight", std::uint32_t{90});
+    storm_config.team_config_weight = ini_loader->get(
+        "mock", "mock.storm.team_config.weight", std::uint32_t{9});
+    storm_config.system_weight =
+        ini_loader->get("mock", "mock.storm.system.weight", std::uint32_t{1});
+
+    spdlog::info("Mock CG constructed. side_a_port: {}, side_b_port: {}, "
+                 "agents: {}, storm_rate: {}/s",
+                 side_a_port, side_b_port, agent_pool.size(),
+                 storm_config.rate);
+  }
+
+  /**
+   * @brief Destroy the Mock CG object
+   *
+   */
+  ~MockCG() = default;
+
+  const MockCG &operator=(const MockCG &) = delete;
+  MockCG(const MockCG &) = delete;
+
+  /**
+   * @brief 서버 실행 (현재 스레드에서 io_context 를 돌린다)
+   *
+   */
+  void run() {
+    openSide(side_a, "A", side_a_port);
+    openSide(side_b, "B", side_b_port);
+
+    if (side_a_fail_after > 0) {
+      asio::co_spawn(io_context, failSideA(), asio::detached);
+    }
+
+    io_context.run();
+  }
+
+protected:
+private:
+  /**
+   * @brief 사이드별 상태
+   *
+   */
+  struct Side {
+    std::optional<asio::ip::tcp::acceptor> acceptor{};
+    std::vector<std::weak_ptr<MockSession>> sessions{};
+  };
+
+  /**
+   * @brief 사이드 리스닝 시작
+   *
+   * @param side
+   * @param name
+   * @param port
+   */
+  void openSide(Side &side, const std::string name, const std::uint16_t port) {
+    side.acceptor.emplace(io_context,
+                          asio::ip::tcp::endpoint{asio::ip::tcp::v4(), port});
+    asio::co_spawn(io_context, listener(side, name), asio::detached);
+
+    spdlog::info("Mock CG side opened. side: {}, port: {}", name, port);
+  }
+
+  /**
+   * @brief 사이드 리스닝 중단 및 세션 종료
+   *
+   * @param side
+   * @param name
+   */
+  void closeSide(Side &side, const std::string name) {
+    if (side.acceptor.has_value()) {
+      asio::error_code error{};
+      side.acceptor->close(error);
+      side.acceptor.reset();
+    }
+
+    for (const std::weak_ptr<MockSession> &session : side.sessions) {
+      if (std::shared_ptr<MockSession> locked = session.lock()) {
+        locked->close();
+      }
+    }
+    side.sessions.clear();
+
+    spdlog::warn("Mock CG side closed. side: {}", name);
+  }
+
+  /**
+   * @brief 접속 수락 코루틴
+   *
+   * @param side
+   * @param name
+   * @return asio::awaitable<void>
+   */
+  asio::awaitable<void> listener(Side &side, const std::string name) {
+    while (side.acceptor.has_value() && side.acceptor->is_open()) {
+      asio::error_code error{};
+      asio::ip::tcp::socket socket = co_await side.acceptor->async_accept(
+          asio::redirect_error(asio::use_awaitable, error));
+      if (error) {
+        co_return;
+      }
+
+      spdlog::info("Mock CG accepted CTI client. side: {}, remote: {}", name,
+                   socket.remote_endpoint(error).address().to_string());
+
+      std::shared_ptr<MockSession> session = std::make_shared<MockSession>(
+          std::move(socket), agent_pool, storm_config, name);
+      session->start();
+
+      std::erase_if(side.sessions, [](const std::weak_ptr<MockSession> &s) {
+        return s.expired();
+      });
+      side.sessions.emplace_back(session);
+    }
+  }
+
+  /**
+   * @brief side A 장애 시뮬레이션
+   *
+   * @return asio::awaitable<void>
+   */
+  asio::awaitable<void> failSideA() {
+    asio::steady_timer timer{io_context};
+
+    timer.expires_after(std::chrono::milliseconds{side_a_fail_after});
+    co_await timer.async_wait(asio::use_awaitable);
+    closeSide(side_a, "A");
+
+    if (side_a_down_for == 0) {
+      co_return;
+    }
+
+    timer.expires_after(std::chrono::milliseconds{side_a_down_for});
+    co_await timer.async_wait(asio::use_awaitable);
+    openSide(side_a, "A", side_a_port);
+  }
+
+  asio::io_context io_context{1};
+  MockAgentPool agent_pool;
+  StormConfig storm_config{};
+
+  std::uint16_t side_a_port;
+  std::uint16_t side_b_port;
+  std::uint32_t side_a_fail_after;
+  std::uint32_t side_a_down_for;
+
+  Side side_a{};
+  Side side_b{};
+};
+} // namespace mock
+
+#endif
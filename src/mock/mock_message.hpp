@@ -0,0 +1,309 @@
+#pragma once
+
+#ifndef _CTM_MOCK_MOCK_MESSAGE_HPP_
+#define _CTM_MOCK_MOCK_MESSAGE_HPP_
+
+/*
+  모의 CG 송신 메시지
+  CTM 이 수신하는 메시지 클래스의 레이아웃을 그대로 사용해 CG 쪽 패킷을
+  만든다. 요청 메시지는 CTM 이 보내는 클래스의 레이아웃으로 해석한다.
+*/
+
+#include "../cisco/common/failure_indication.hpp"
+#include "../cisco/common/floating_layout.hpp"
+#include "../cisco/common/message_type.hpp"
+#include "../cisco/common/mhdr.hpp"
+#include "../cisco/common/packet_builder.hpp"
+#include "../cisco/common/serializable.hpp"
+#include "../cisco/common/tag_value.hpp"
+#include "../cisco/control/query_agent_state_conf.hpp"
+#include "../cisco/control/query_agent_state_req.hpp"
+#include "../cisco/message/agent_state_event.hpp"
+#include "../cisco/miscellaneous/system_event.hpp"
+#include "../cisco/session/heartbeat_conf.hpp"
+#include "../cisco/session/heartbeat_req.hpp"
+#include "../cisco/session/open_conf.hpp"
+#include "../cisco/session/open_req.hpp"
+#include "../cisco/supervisor/agent_team_config_event.hpp"
+#include "./mock_agent.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace mock {
+/**
+ * @brief OPEN_REQ 해석 (MHDR 제외)
+ *
+ * @param body
+ * @return cisco::session::OpenReq InvokeID, PeripheralID 만 채워진다
+ */
+inline cisco::session::OpenReq
+decodeOpenReq(const std::span<const std::byte> body) {
+  using cisco::common::MessageLayout;
+  using cisco::session::OpenReq;
+
+  cisco::common::ByteReader reader{body};
+  OpenReq open_req{};
+  MessageLayout<OpenReq>::decode(
+      reader, open_req,
+      MessageLayout<OpenReq>::maskOf<&OpenReq::getInvokeID,
+                                     &OpenReq::getPeripheralID>());
+
+  return open_req;
+}
+
+/**
+ * @brief HEARTBEAT_REQ 해석 (MHDR 제외)
+ *
+ * @param body
+ * @return cisco::session::HeartbeatReq
+ */
+inline cisco::session::HeartbeatReq
+decodeHeartbeatReq(const std::span<const std::byte> body) {
+  using cisco::common::MessageLayout;
+  using cisco::session::HeartbeatReq;
+
+  cisco::common::ByteReader reader{body};
+  HeartbeatReq heartbeat_req{};
+  MessageLayout<HeartbeatReq>::decode(reader, heartbeat_req);
+
+  return heartbeat_req;
+}
+
+/**
+ * @brief QUERY_AGENT_STATE_REQ 가변 영역 중 모의 CG 가 읽는 태그
+ *
+ */
+using QueryAgentStateReqFloating = cisco::common::FloatingLayout<
+    cisco::control::QueryAgentStateReq,
+    cisco::common::FloatingField<
+        cisco::common::TagValue::AGENT_ID_TAG,
+        &cisco::control::QueryAgentStateReq::setAgentID>>;
+
+/**
+ * @brief QUERY_AGENT_STATE_REQ 해석 (MHDR 제외)
+ *
+ * @param body
+ * @return cisco::control::QueryAgentStateReq
+ */
+inline cisco::control::QueryAgentStateReq
+decodeQueryAgentStateReq(const std::span<const std::byte> body) {
+  using cisco::common::MessageLayout;
+  using cisco::control::QueryAgentStateReq;
+
+  cisco::common::ByteReader reader{body};
+  QueryAgentStateReq query_agent_state_req{};
+  MessageLayout<QueryAgentStateReq>::decode(reader, query_agent_state_req);
+  QueryAgentStateReqFloating::decode(reader, body.size(),
+                                     query_agent_state_req);
+
+  return query_agent_state_req;
+}
+
+/**
+ * @brief OPEN_CONF
+ *
+ * @param invoke_id
+ * @return std::vector<std::byte>
+ */
+inline std::vector<std::byte> makeOpenConf(const std::uint32_t invoke_id) {
+  using cisco::session::OpenConf;
+
+  return cisco::common::PacketBuilder<OpenConf>{
+      cisco::common::MessageType::OPEN_CONF}
+      .fixed<&OpenConf::getInvokeID>(invoke_id)
+      .fixed<&OpenConf::getServiceGranted>(0x94)
+      .fixed<&OpenConf::getMonitorID>(1)
+      .fixed<&OpenConf::getPGStatus>(0)
+      .fixed<&OpenConf::getPeripheralOnline>(true)
+      .fixed<&OpenConf::getPeripheralType>(1)
+      .fixed<&OpenConf::getDepartmentID>(-1)
+      .floating(cisco::common::TagValue::NUM_PERIPHERALS_TAG, std::uint16_t{1})
+      .floating(cisco::common::TagValue::MULTI_LINE_AGENT_CONTROL_TAG,
+                std::uint16_t{0})
+      .build();
+}
+
+/**
+ * @brief HEARTBEAT_CONF
+ *
+ * @param invoke_id
+ * @return std::vector<std::byte>
+ */
+inline std::vector<std::byte>
+makeHeartbeatConf(const std::uint32_t invoke_id) {
+  using cisco::session::HeartbeatConf;
+
+  return cisco::common::PacketBuilder<HeartbeatConf>{
+      cisco::common::MessageType::HEARTBEAT_CONF}
+      .fixed<&HeartbeatConf::getInvokeID>(invoke_id)
+      .build();
+}
+
+/**
+ * @brief QUERY_AGENT_STATE_CONF
+ *
+ * @param invoke_id
+ * @param agent
+ * @return std::vector<std::byte>
+ */
+inline std::vector<std::byte>
+makeQueryAgentStateConf(const std::uint32_t invoke_id, const MockAgent &agent) {
+  using cisco::common::TagValue;
+  using cisco::control::QueryAgentStateConf;
+
+  return cisco::common::PacketBuilder<QueryAgentStateConf>{
+      cisco::common::MessageType::QUERY_AGENT_STATE_CONF}
+      .fixed<&QueryAgentStateConf::getInvokeID>(invoke_id)
+      .fixed<&QueryAgentStateConf::getAgentState>(
+          static_cast<std::uint16_t>(agent.agent_state))
+      .fixed<&QueryAgentStateConf::getNumSkillGroups>(1)
+      .fixed<&QueryAgentStateConf::getICMAgentID>(agent.icm_agent_id)
+      .floating(TagValue::AGENT_ID_TAG, agent.agent_id)
+      .floating(TagValue::AGENT_EXTENSION_TAG, agent.agent_extension)
+      .floating(TagValue::AGENT_INSTRUMENT_TAG, agent.agent_extension)
+      .floating(TagValue::SKILL_GROUP_NUMBER_TAG,
+                static_cast<std::uint32_t>(agent.skill_group_number))
+      .floating(TagValue::SKILL_GROUP_ID_TAG, agent.skill_group_id)
+      .floating(TagValue::SKILL_GROUP_PRIORITY_TAG, std::uint16_t{0})
+      .floating(TagValue::SKILL_GROUP_STATE_TAG,
+                static_cast<std::uint16_t>(agent.agent_state))
+      .floating(TagValue::INTERNAL_AGENT_STATE_TAG,
+                static_cast<std::uint16_t>(agent.agent_state))
+      .build();
+}
+
+/**
+ * @brief CONTROL_FAILURE_CONF
+ * +------+----------+-------------+---------------------+
+ * | MHDR | InvokeID | FailureCode | PeripheralErrorCode |
+ * +------+----------+-------------+---------------------+
+ * 수신 메시지 클래스가 없어 필드를 직접 기록한다.
+ *
+ * @param invoke_id
+ * @param failure_code
+ * @return std::vector<std::byte>
+ */
+inline std::vector<std::byte> makeControlFailureConf(
+    const std::uint32_t invoke_id,
+    const cisco::common::FailureIndicationStatusCode failure_code) {
+  cisco::common::MHDR mhdr{};
+  mhdr.setMessageType(cisco::common::MessageType::CONTROL_FAILURE_CONF);
+  mhdr.setMessageLength(12);
+
+  cisco::common::ByteWriter writer{
+      cisco::common::field_size_v<cisco::common::MHDR> + 12};
+  writer.write(mhdr);
+  writer.write(invoke_id);
+  writer.write(failure_code);
+  writer.write(std::uint32_t{0});
+
+  return writer.release();
+}
+
+/**
+ * @brief AGENT_STATE_EVENT
+ *
+ * @param peripheral_id
+ * @param agent
+ * @return std::vector<std::byte>
+ */
+inline std::vector<std::byte>
+makeAgentStateEvent(const std::uint32_t peripheral_id, const MockAgent &agent) {
+  using cisco::common::TagValue;
+  using cisco::message::AgentStateEvent;
+
+  return cisco::common::PacketBuilder<AgentStateEvent>{
+      cisco::common::MessageType::AGENT_STATE_EVENT}
+      .fixed<&AgentStateEvent::getMonitorID>(1)
+      .fixed<&AgentStateEvent::getPeripheralID>(peripheral_id)
+      .fixed<&AgentStateEvent::getPeripheralType>(1)
+      .fixed<&AgentStateEvent::getSkillGroupState>(
+          static_cast<std::uint16_t>(agent.agent_state))
+      .fixed<&AgentStateEvent::getStateDuration>(agent.getStateDuration())
+      .fixed<&AgentStateEvent::getSkillGroupNumber>(agent.skill_group_number)
+      .fixed<&AgentStateEvent::getSkillGroupID>(agent.skill_group_id)
+      .fixed<&AgentStateEvent::getAgentState>(
+          static_cast<std::uint16_t>(agent.agent_state))
+      .fixed<&AgentStateEvent::getICMAgentID>(agent.icm_agent_id)
+      .fixed<&AgentStateEvent::getNumFltSkillGroups>(1)
+      .floating(TagValue::CTI_CLIENT_SIGNATURE_TAG, "ctmonitor")
+      .floating(TagValue::AGENT_ID_TAG, agent.agent_id)
+      .floating(TagValue::AGENT_EXTENSION_TAG, agent.agent_extension)
+      .floating(TagValue::AGENT_INSTRUMENT_TAG, agent.agent_extension)
+      .floating(TagValue::DURATION_TAG, agent.getStateDuration())
+      .floating(TagValue::DIRECTION_TAG, std::uint32_t{0})
+      .floating(TagValue::SKILL_GROUP_NUMBER_TAG, agent.skill_group_number)
+      .floating(TagValue::SKILL_GROUP_ID_TAG, agent.skill_group_id)
+      .floating(TagValue::SKILL_GROUP_PRIORITY_TAG, std::uint16_t{0})
+      .floating(TagValue::SKILL_GROUP_STATE_TAG,
+                static_cast<std::uint16_t>(agent.agent_state))
+      .build();
+}
+
+/**
+ * @brief AGENT_TEAM_CONFIG_EVENT
+ *
+ * @param peripheral_id
+ * @param team_id
+ * @param agents 팀 구성원 (첫 상담원을 감독자로 표시)
+ * @return std::vector<std::byte>
+ */
+inline std::vector<std::byte>
+makeAgentTeamConfigEvent(const std::uint32_t peripheral_id,
+                         const std::uint32_t team_id,
+                         const std::span<const MockAgent> agents) {
+  using cisco::common::TagValue;
+  using cisco::supervisor::AgentTeamConfigEvent;
+
+  cisco::common::PacketBuilder<AgentTeamConfigEvent> builder{
+      cisco::common::MessageType::AGENT_TEAM_CONFIG_EVENT};
+  builder.fixed<&AgentTeamConfigEvent::getPeripheralID>(peripheral_id)
+      .fixed<&AgentTeamConfigEvent::getTeamID>(team_id)
+      .fixed<&AgentTeamConfigEvent::getNumberOfAgent>(
+          static_cast<std::uint16_t>(agents.size()))
+      .fixed<&AgentTeamConfigEvent::getDepartmentID>(-1)
+      .floating(TagValue::AGENT_TEAM_NAME_TAG,
+                "Mock Team " + std::to_string(team_id));
+
+  for (std::size_t i = 0; i < agents.size(); i++) {
+    builder.floating(TagValue::ATC_AGENT_ID_TAG, agents[i].agent_id)
+        .floating(TagValue::AGENT_FLAGS_TAG,
+                  static_cast<std::uint16_t>(i == 0 ? 1 : 0))
+        .floating(TagValue::ATC_AGENT_STATE_TAG,
+                  static_cast<std::uint16_t>(agents[i].agent_state))
+        .floating(TagValue::ATC_AGENT_STATE_DURATION_TAG,
+                  static_cast<std::uint16_t>(agents[i].getStateDuration()));
+  }
+
+  return builder.build();
+}
+
+/**
+ * @brief SYSTEM_EVENT
+ *
+ * @param system_event_id
+ * @param text
+ * @return std::vector<std::byte>
+ */
+inline std::vector<std::byte>
+makeSystemEvent(const std::uint32_t system_event_id,
+                const std::string_view text) {
+  using cisco::common::TagValue;
+  using cisco::misc::SystemEvent;
+
+  return cisco::common::PacketBuilder<SystemEvent>{
+      cisco::common::MessageType::SYSTEM_EVENT}
+      .fixed<&SystemEvent::getPGStatus>(0)
+      .fixed<&SystemEvent::getSystemEventID>(system_event_id)
+      .fixed<&SystemEvent::getEventDeviceType>(0xffff)
+      .floating(TagValue::TEXT_TAG, text)
+      .floating(TagValue::EVENT_DEVICE_ID_TAG, "PG1A")
+      .build();
+}
+} // namespace mock
+
+#endif
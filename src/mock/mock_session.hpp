@@ -0,0 +1,356 @@
+#pragma once
+
+#ifndef _CTM_MOCK_MOCK_SESSION_HPP_
+#define _CTM_MOCK_MOCK_SESSION_HPP_
+
+#include "../cisco/common/failure_indication.hpp"
+#include "../cisco/common/message_type.hpp"
+#include "../cisco/common/mhdr.hpp"
+#include "../cisco/common/serializable.hpp"
+#include "./mock_agent.hpp"
+#include "./mock_message.hpp"
+
+#include <asio/awaitable.hpp>
+#include <asio/buffer.hpp>
+#include <asio/co_spawn.hpp>
+#include <asio/detached.hpp>
+#include <asio/error_code.hpp>
+#include <asio/ip/tcp.hpp>
+#include <asio/read.hpp>
+#include <asio/redirect_error.hpp>
+#include <asio/steady_timer.hpp>
+#include <asio/this_coro.hpp>
+#include <asio/use_awaitable.hpp>
+#include <asio/write.hpp>
+#include <spdlog/spdlog.h>
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <random>
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace mock {
+/**
+ * @brief 이벤트 폭주 설정
+ *
+ */
+struct StormConfig {
+  std::uint32_t peripheral_id{5000};
+  // 초당 이벤트 수 (0 이면 요청에만 응답)
+  std::uint32_t rate{0};
+  // OPEN_CONF 이후 이벤트 시작까지의 대기
+  std::chrono::milliseconds delay{1'000};
+  // 이벤트 종류별 가중치
+  std::uint32_t agent_state_weight{90};
+  std::uint32_t team_config_weight{9};
+  std::uint32_t system_weight{1};
+  // 송신 대기열이 이 이상이면 이벤트 생성을 건너뛴다
+  std::size_t max_pending{65'536};
+};
+
+/**
+ * @brief 모의 CG 세션 (CTM 접속 하나)
+ *
+ * 단일 스레드 io_context 에서 동작한다. 요청 응답과 이벤트가 섞이지 않도록
+ * 송신은 대기열 하나로 모으고, 쓰기 코루틴이 쌓인 패킷을 한 번에 보낸다.
+ */
+class MockSession : public std::enable_shared_from_this<MockSession> {
+public:
+  /**
+   * @brief Construct a new Mock Session object
+   *
+   * @param socket
+   * @param agent_pool 세션 간 공유하는 상담원 목록
+   * @param storm_config
+   * @param side "A" 또는 "B"
+   */
+  MockSession(asio::ip::tcp::socket socket, MockAgentPool &agent_pool,
+              const StormConfig &storm_config, const std::string side)
+      : socket{std::move(socket)}, write_signal{this->socket.get_executor()},
+        agent_pool{agent_pool}, storm_config{storm_config}, side{side},
+        event_distribution{
+            {static_cast<double>(storm_config.agent_state_weight),
+             static_cast<double>(storm_config.team_config_weight),
+             static_cast<double>(storm_config.system_weight)}} {
+    write_signal.expires_at(std::chrono::steady_clock::time_point::max());
+  }
+
+  /**
+   * @brief Destroy the Mock Session object
+   *
+   */
+  ~MockSession() = default;
+
+  /**
+   * @brief 세션 시작
+   *
+   */
+  void start() {
+    std::shared_ptr<MockSession> self = shared_from_this();
+
+    asio::co_spawn(socket.get_executor(), reader(),
+                   [self](const std::exception_ptr) { self->close(); });
+    asio::co_spawn(socket.get_executor(), writer(),
+                   [self](const std::exception_ptr) { self->close(); });
+  }
+
+  /**
+   * @brief 세션 종료 (side 장애 시뮬레이션에도 사용)
+   *
+   */
+  void close() {
+    if (closed) {
+      return;
+    }
+    closed = true;
+
+    spdlog::info("Mock CG session closed. side: {}, events_sent: {}", side,
+                 events_sent);
+
+    asio::error_code error{};
+    socket.shutdown(asio::ip::tcp::socket::shutdown_both, error);
+    socket.close(error);
+    write_signal.cancel();
+  }
+
+  /**
+   * @brief 종료 여부
+   *
+   * @return true
+   * @return false
+   */
+  bool isClosed() const { return closed; }
+
+  /**
+   * @brief 지금까지 보낸 이벤트 수
+   *
+   * @return std::uint64_t
+   */
+  std::uint64_t getEventsSent() const { return events_sent; }
+
+protected:
+private:
+  /**
+   * @brief 요청 수신 코루틴 (MHDR 을 읽고 본문을 읽는다)
+   *
+   * @return asio::awaitable<void>
+   */
+  asio::awaitable<void> reader() {
+    std::array<std::byte, cisco::common::field_size_v<cisco::common::MHDR>>
+        header{};
+    std::vector<std::byte> body{};
+
+    while (!closed) {
+      co_await asio::async_read(socket, asio::buffer(header),
+                                asio::use_awaitable);
+      const cisco::common::MHDR mhdr =
+          cisco::common::deserialize<cisco::common::MHDR>(header);
+
+      body.resize(mhdr.getMessageLength());
+      co_await asio::async_read(socket, asio::buffer(body),
+                                asio::use_awaitable);
+
+      handleRequest(mhdr.getMessageType(), body);
+    }
+  }
+
+  /**
+   * @brief 송신 코루틴 (쌓인 패킷을 한 번의 쓰기로 보낸다)
+   *
+   * @return asio::awaitable<void>
+   */
+  asio::awaitable<void> writer() {
+    std::deque<std::vector<std::byte>> sending{};
+    std::vector<asio::const_buffer> buffers{};
+
+    while (!closed) {
+      if (pending.empty()) {
+        asio::error_code error{};
+        co_await write_signal.async_wait(
+            asio::redirect_error(asio::use_awaitable, error));
+        continue;
+      }
+
+      sending.swap(pending);
+      buffers.clear();
+      for (const std::vector<std::byte> &packet : sending) {
+        buffers.emplace_back(asio::buffer(packet));
+      }
+
+      co_await asio::async_write(socket, buffers, asio::use_awaitable);
+      sending.clear();
+    }
+  }
+
+  /**
+   * @brief 이벤트 폭주 코루틴
+   *
+   * 1ms 마다 목표 속도 기준으로 밀린 만큼의 이벤트를 만든다.
+   *
+   * @return asio::awaitable<void>
+   */
+  asio::awaitable<void> storm() {
+    asio::steady_timer timer{socket.get_executor()};
+
+    timer.expires_after(storm_config.delay);
+    co_await timer.async_wait(asio::use_awaitable);
+
+    spdlog::info("Mock CG event storm started. side: {}, rate: {}/s, "
+                 "agents: {}",
+                 side, storm_config.rate, agent_pool.size());
+
+    const std::chrono::steady_clock::time_point begin =
+        std::chrono::steady_clock::now();
+    std::chrono::steady_clock::time_point report = begin;
+    std::uint64_t generated{0};
+    std::uint64_t skipped{0};
+    std::uint64_t reported{0};
+
+    while (!closed) {
+      const std::chrono::steady_clock::time_point now =
+          std::chrono::steady_clock::now();
+      const std::uint64_t due = static_cast<std::uint64_t>(
+          std::chrono::duration<double>(now - begin).count() *
+          storm_config.rate);
+
+      for (; generated < due; generated++) {
+        // 상대가 따라오지 못하면 대기열을 키우지 않고 건너뛴다
+        if (pending.size() >= storm_config.max_pending) {
+          skipped += due - generated;
+          generated = due;
+          break;
+        }
+
+        pushEvent();
+      }
+
+      if (now - report >= std::chrono::seconds{1}) {
+        spdlog::info("Mock CG event storm. side: {}, events_per_second: {}, "
+                     "skipped: {}, pending: {}",
+                     side, events_sent - reported, skipped, pending.size());
+        report = now;
+        reported = events_sent;
+      }
+
+      timer.expires_after(std::chrono::milliseconds{1});
+      co_await timer.async_wait(asio::use_awaitable);
+    }
+  }
+
+  /**
+   * @brief 가중치에 따라 이벤트 하나를 송신 대기열에 넣는다
+   *
+   */
+  void pushEvent() {
+    switch (event_distribution(random_engine)) {
+    case 0:
+      send(makeAgentStateEvent(storm_config.peripheral_id,
+                               agent_pool.advance()));
+      break;
+    case 1: {
+      const std::size_t team = next_team;
+      next_team = (next_team + 1) % agent_pool.getTeamCount();
+
+      send(makeAgentTeamConfigEvent(storm_config.peripheral_id,
+                                    static_cast<std::uint32_t>(5'000 + team),
+                                    agent_pool.getTeam(team)));
+    } break;
+    default:
+      send(makeSystemEvent(1, "Mock peripheral is online"));
+      break;
+    }
+
+    events_sent++;
+  }
+
+  /**
+   * @brief 요청 처리
+   *
+   * @param message_type
+   * @param body MHDR 을 제외한 본문
+   */
+  void handleRequest(const cisco::common::MessageType message_type,
+                     const std::span<const std::byte> body) {
+    switch (message_type) {
+    case cisco::common::MessageType::OPEN_REQ: {
+      const cisco::session::OpenReq open_req = decodeOpenReq(body);
+
+      spdlog::info("Mock CG received OPEN_REQ. side: {}, invoke_id: {}, "
+                   "peripheral_id: {}",
+                   side, open_req.getInvokeID(), open_req.getPeripheralID());
+      send(makeOpenConf(open_req.getInvokeID()));
+
+      if (storm_config.rate > 0 && agent_pool.size() > 0) {
+        std::shared_ptr<MockSession> self = shared_from_this();
+        asio::co_spawn(socket.get_executor(), storm(),
+                       [self](const std::exception_ptr) { self->close(); });
+      }
+    } break;
+    case cisco::common::MessageType::HEARTBEAT_REQ: {
+      const cisco::session::HeartbeatReq heartbeat_req =
+          decodeHeartbeatReq(body);
+
+      spdlog::debug("Mock CG received HEARTBEAT_REQ. side: {}, invoke_id: {}",
+                    side, heartbeat_req.getInvokeID());
+      send(makeHeartbeatConf(heartbeat_req.getInvokeID()));
+    } break;
+    case cisco::common::MessageType::QUERY_AGENT_STATE_REQ: {
+      const cisco::control::QueryAgentStateReq query_agent_state_req =
+          decodeQueryAgentStateReq(body);
+      const MockAgent *agent =
+          query_agent_state_req.getAgentID().has_value()
+              ? agent_pool.find(query_agent_state_req.getAgentID().value())
+              : nullptr;
+
+      if (agent != nullptr) {
+        send(makeQueryAgentStateConf(query_agent_state_req.getInvokeID(),
+                                     *agent));
+      } else {
+        send(makeControlFailureConf(
+            query_agent_state_req.getInvokeID(),
+            cisco::common::FailureIndicationStatusCode::
+                E_CTI_INVALID_AGENT_DATA));
+      }
+    } break;
+    default:
+      spdlog::debug("Mock CG ignored message. side: {}, message_type: {}",
+                    side, static_cast<std::uint32_t>(message_type));
+      break;
+    }
+  }
+
+  /**
+   * @brief 송신 대기열에 패킷을 넣고 쓰기 코루틴을 깨운다
+   *
+   * @param packet
+   */
+  void send(std::vector<std::byte> packet) {
+    pending.emplace_back(std::move(packet));
+    write_signal.cancel_one();
+  }
+
+  asio::ip::tcp::socket socket;
+  asio::steady_timer write_signal;
+  std::deque<std::vector<std::byte>> pending{};
+
+  MockAgentPool &agent_pool;
+  StormConfig storm_config;
+  std::string side;
+
+  std::mt19937 random_engine{std::random_device{}()};
+  std::discrete_distribution<int> event_distribution;
+  std::size_t next_team{0};
+  std::uint64_t events_sent{0};
+  bool closed{false};
+};
+} // namespace mock
+
+#endif
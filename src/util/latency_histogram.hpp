@@ -0,0 +1,135 @@
+#pragma once
+
+#ifndef _CTM_UTIL_LATENCY_HISTOGRAM_HPP_
+#define _CTM_UTIL_LATENCY_HISTOGRAM_HPP_
+
+/*
+  지연 시간 히스토그램 (마이크로초, 2 의 거듭제곱 구간)
+  +-----+-----+-------+-------+-----+-------------------+
+  | 0   | 1   | 2 - 3 | 4 - 7 | ... | 2^30 - (2^31 - 1) |
+  +-----+-----+-------+-------+-----+-------------------+
+  기록은 구간 카운터 하나를 올리는 것으로 끝나며, 백분위는 해당 구간의 상한으로
+  근사한다.
+*/
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace util {
+class LatencyHistogram {
+public:
+  /**
+   * @brief 구간 수
+   *
+   */
+  static constexpr std::size_t bucket_count = 32;
+
+  /**
+   * @brief Construct a new Latency Histogram object
+   *
+   */
+  LatencyHistogram() = default;
+
+  /**
+   * @brief Destroy the Latency Histogram object
+   *
+   */
+  ~LatencyHistogram() = default;
+
+  /**
+   * @brief 지연 시간 기록
+   *
+   * @param latency
+   */
+  void record(const std::chrono::nanoseconds latency) {
+    const std::int64_t signed_micros =
+        std::chrono::duration_cast<std::chrono::microseconds>(latency).count();
+    const std::uint64_t micros =
+        static_cast<std::uint64_t>(std::max<std::int64_t>(signed_micros, 0));
+
+    buckets[std::min<std::size_t>(std::bit_width(micros), bucket_count - 1)]++;
+    count++;
+    total_micros += micros;
+    max_micros = std::max(max_micros, micros);
+  }
+
+  /**
+   * @brief 기록 수
+   *
+   * @return std::uint64_t
+   */
+  std::uint64_t getCount() const { return count; }
+
+  /**
+   * @brief 평균 지연 시간
+   *
+   * @return std::chrono::microseconds
+   */
+  std::chrono::microseconds getMean() const {
+    return std::chrono::microseconds{
+        count == 0 ? 0 : static_cast<std::int64_t>(total_micros / count)};
+  }
+
+  /**
+   * @brief 최대 지연 시간
+   *
+   * @return std::chrono::microseconds
+   */
+  std::chrono::microseconds getMax() const {
+    return std::chrono::microseconds{static_cast<std::int64_t>(max_micros)};
+  }
+
+  /**
+   * @brief 백분위 지연 시간 (구간 상한, 최대값을 넘지 않음)
+   *
+   * @param percentile 0 ~ 100
+   * @return std::chrono::microseconds
+   */
+  std::chrono::microseconds getPercentile(const double percentile) const {
+    if (count == 0) {
+      return std::chrono::microseconds{0};
+    }
+
+    const std::uint64_t rank = std::max<std::uint64_t>(
+        static_cast<std::uint64_t>(static_cast<double>(count) * percentile /
+                                   100.0),
+        1);
+
+    std::uint64_t seen = 0;
+    for (std::size_t i = 0; i < bucket_count; i++) {
+      seen += buckets[i];
+      if (seen >= rank) {
+        const std::uint64_t upper = i == 0 ? 0 : (std::uint64_t{1} << i) - 1;
+        return std::chrono::microseconds{
+            static_cast<std::int64_t>(std::min(upper, max_micros))};
+      }
+    }
+
+    return getMax();
+  }
+
+  /**
+   * @brief 기록 초기화
+   *
+   */
+  void reset() {
+    buckets.fill(0);
+    count = 0;
+    total_micros = 0;
+    max_micros = 0;
+  }
+
+protected:
+private:
+  std::array<std::uint64_t, bucket_count> buckets{};
+  std::uint64_t count{0};
+  std::uint64_t total_micros{0};
+  std::uint64_t max_micros{0};
+};
+} // namespace util
+
+#endif
@@ -0,0 +1,85 @@
+#pragma once
+
+#ifndef _CTM_UTIL_TOKEN_BUCKET_HPP_
+#define _CTM_UTIL_TOKEN_BUCKET_HPP_
+
+#include <algorithm>
+#include <chrono>
+
+namespace util {
+/**
+ * @brief 송신 속도 제한 (토큰 버킷)
+ *
+ * 초당 rate 개씩 토큰이 차고, 최대 burst 개까지 쌓인다. 토큰 하나가 요청
+ * 하나를 보낼 권리다. 한 스레드에서만 사용한다.
+ */
+class TokenBucket {
+public:
+  using clock = std::chrono::steady_clock;
+
+  /**
+   * @brief Construct a new Token Bucket object
+   *
+   * @param rate 초당 토큰 수 (0 이하면 제한 없음)
+   * @param burst 최대 토큰 수
+   */
+  TokenBucket(const double rate, const double burst)
+      : rate{rate}, burst{std::max(burst, 1.0)}, tokens{this->burst} {}
+
+  /**
+   * @brief Destroy the Token Bucket object
+   *
+   */
+  ~TokenBucket() = default;
+
+  /**
+   * @brief 지난 시간만큼 토큰을 채운다
+   *
+   * @param now
+   */
+  void refill(const clock::time_point now) {
+    if (last_refill != clock::time_point{}) {
+      const std::chrono::duration<double> elapsed = now - last_refill;
+      tokens = std::min(burst, tokens + elapsed.count() * rate);
+    }
+    last_refill = now;
+  }
+
+  /**
+   * @brief 토큰 하나를 꺼낸다
+   *
+   * @return true
+   * @return false 토큰이 없음
+   */
+  bool tryTake() {
+    if (rate <= 0.0) {
+      return true;
+    }
+
+    if (tokens < 1.0) {
+      return false;
+    }
+
+    tokens -= 1.0;
+    return true;
+  }
+
+  /**
+   * @brief 토큰을 가득 채운 상태로 되돌린다
+   *
+   */
+  void reset() {
+    tokens = burst;
+    last_refill = clock::time_point{};
+  }
+
+protected:
+private:
+  double rate;
+  double burst;
+  double tokens;
+  clock::time_point last_refill{};
+};
+} // namespace util
+
+#endif